@@ -0,0 +1,299 @@
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include "EasyByteParserCpp/ByteParser.hpp"
+#include "EasyByteParserCpp/Schema.hpp"
+#include "EasyByteParserCpp/WorkerPool.hpp"
+#include "SimdKernels.hpp"
+#include "Utils.hpp"
+
+using namespace easy_byte_parser;
+
+namespace {
+
+/// Best time in nanoseconds per call of \p fn over a few repetitions.
+template <typename Fn>
+double timeNs(Fn&& fn, size_t iterations) {
+  double best = 1e300;
+  for (int rep = 0; rep < 5; ++rep) {
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < iterations; ++i) fn();
+    auto stop = std::chrono::steady_clock::now();
+    best = std::min(best, std::chrono::duration<double, std::nano>(stop - start).count() / iterations);
+  }
+  return best;
+}
+
+void report(const char* name, double ns, size_t bytes) {
+  std::cout << "  " << std::left << std::setw(24) << name << std::right << std::setw(12) << std::fixed
+            << std::setprecision(1) << ns << " ns" << std::setw(10) << std::setprecision(2) << bytes / ns
+            << " GB/s" << std::endl;
+}
+
+/// Byte-by-byte search as a baseline.
+size_t naiveFind(const char* data, size_t size, const uint8_t* code, size_t length) {
+  for (size_t pos = 0; pos < size; ++pos) {
+    size_t n = std::min(length, size - pos);
+    size_t k = 0;
+    while (k < n && static_cast<uint8_t>(data[pos + k]) == code[k]) ++k;
+    if (k == n) return pos;
+  }
+  return size;
+}
+
+void benchStartCodeScan() {
+  std::cout << "Start code scan, 64 KiB of garbage before the start code" << std::endl;
+  const uint8_t code[] = {0x02, 0x03};
+  std::vector<char> data(64 * 1024);
+  std::srand(1);
+  for (auto& b : data) {
+    // Garbage with many 0x02 bytes, but without the start code
+    b = static_cast<char>(std::rand() % 8 == 0 ? 0x02 : std::rand() & 0xFF);
+    if (b == 0x03) b = 0x04;
+  }
+  std::memcpy(data.data() + data.size() - 2, code, 2);
+
+  volatile size_t sink = 0;
+  const size_t iterations = 200;
+  report("naive byte loop", timeNs([&] { sink = naiveFind(data.data(), data.size(), code, 2); }, iterations),
+         data.size());
+  report("memchr + memcmp",
+         timeNs([&] { sink = utils::findStartCode(data.data(), data.size(), code, 2); }, iterations), data.size());
+  for (auto level : {simd::Level::SSE41, simd::Level::AVX2}) {
+    if (simd::supportedLevel() < level) continue;
+    simd::setLevelLimit(level);
+    report(level == simd::Level::AVX2 ? "simd AVX2" : "simd SSE2",
+           timeNs([&] { sink = simd::findStartCode(data.data(), data.size(), code, 2); }, iterations), data.size());
+  }
+  simd::setLevelLimit(simd::Level::AVX2);
+  (void)sink;
+}
+
+/// 32-byte frames with a mix of field types, start code and CRC16.
+ByteParser makeBenchParser() {
+  ByteParser parser;
+  parser.setTotalLength(32)
+      .setStartCode({0xA5}, 1)
+      .setCRC("CRC16", 2)
+      .addField<uint8_t>("u8", 1)
+      .addField<uint16_t>("u16", 3)
+      .addField<int16_t>("i16", 5, 0, 0, false)
+      .addField<uint32_t>("u32", 7, 0, 0, false)
+      .addField<int32_t>("i32.scaled", 11, 0, 0, true, 0.25, -3.0)
+      .addField<float>("f", 15, 0, 0, false)
+      .addField<bool>("flag", 19, 3, 1)
+      .addField<int16_t>("bits", 20, 4, 9)
+      .addField<uint16_t>("u16.bits.scaled", 28, 2, 12, false, 0.1, 0.0);
+  return parser;
+}
+
+std::vector<char> makeBenchFrames(size_t count) {
+  std::vector<char> data(count * 32);
+  std::srand(2);
+  for (size_t i = 0; i < count; ++i) {
+    char* frame = data.data() + i * 32;
+    for (size_t k = 0; k < 32; ++k) frame[k] = static_cast<char>(std::rand() & 0xFF);
+    frame[0] = static_cast<char>(0xA5);
+    uint16_t crc = utils::calculateCRC16Modbus(reinterpret_cast<const uint8_t*>(frame), 30);
+    frame[30] = static_cast<char>(crc & 0xFF);
+    frame[31] = static_cast<char>(crc >> 8);
+  }
+  return data;
+}
+
+void benchParallelBatch() {
+  const size_t count = 1 << 21;
+  std::cout << "Parallel columnar parseBatch, " << count << " frames of 32 bytes" << std::endl;
+  ByteParser parser = makeBenchParser();
+  std::vector<char> data = makeBenchFrames(count);
+  ColumnarBatch batch;
+
+  const size_t maxThreads = std::max(1u, std::thread::hardware_concurrency());
+  double single = 0.0;
+  for (size_t threads = 1; threads <= maxThreads; threads *= 2) {
+    WorkerPool pool(threads);
+    double ns = timeNs([&] { parser.parseBatch(data.data(), count, 32, batch, pool); }, 3);
+    if (threads == 1) single = ns;
+    std::cout << "  " << std::setw(3) << threads << " threads" << std::setw(12) << std::fixed << std::setprecision(1)
+              << count / ns * 1e3 << " Mframes/s" << std::setw(10) << std::setprecision(2) << data.size() / ns
+              << " GB/s" << std::setw(8) << single / ns << "x" << std::endl;
+  }
+}
+
+void benchConstParseThreads() {
+  const size_t count = 1 << 20;
+  std::cout << "Const parse() through one shared parser, " << count << " frames of 32 bytes" << std::endl;
+  ByteParser configured = makeBenchParser();
+  configured.compile();
+  const ByteParser& parser = configured;
+  std::vector<char> data = makeBenchFrames(count);
+
+  const size_t maxThreads = std::max(1u, std::thread::hardware_concurrency());
+  double single = 0.0;
+  for (size_t threads = 1; threads <= maxThreads; threads *= 2) {
+    double ns = timeNs(
+        [&] {
+          std::vector<std::thread> workers;
+          for (size_t t = 0; t < threads; ++t) {
+            workers.emplace_back([&, t] {
+              ParseResult result;
+              for (size_t i = t; i < count; i += threads) parser.parse(data.data() + i * 32, 32, result);
+            });
+          }
+          for (auto& worker : workers) worker.join();
+        },
+        1);
+    if (threads == 1) single = ns;
+    std::cout << "  " << std::setw(3) << threads << " threads" << std::setw(12) << std::fixed << std::setprecision(1)
+              << count / ns * 1e3 << " Mframes/s" << std::setw(8) << std::setprecision(2) << single / ns << "x"
+              << std::endl;
+  }
+}
+
+void benchFrameView() {
+  const size_t count = 1 << 20;
+  std::cout << "Reading 2 of 9 fields, " << count << " frames of 32 bytes" << std::endl;
+  ByteParser parser = makeBenchParser();
+  std::vector<char> data = makeBenchFrames(count);
+  auto u16 = parser.fieldHandle<uint64_t>("u16");
+  auto f = parser.fieldHandle<double>("f");
+  const ByteParser& shared = parser;
+
+  double sum = 0.0;
+  ParseResult result;
+  double parseNs = timeNs(
+      [&] {
+        for (size_t i = 0; i < count; ++i) {
+          shared.parse(data.data() + i * 32, 32, result);
+          sum += result.get(u16) + result.get(f);
+        }
+      },
+      1);
+  FrameView view;
+  double viewNs = timeNs(
+      [&] {
+        for (size_t i = 0; i < count; ++i) {
+          shared.tryView(data.data() + i * 32, 32, view);
+          sum += view.get(u16) + view.get(f);
+        }
+      },
+      1);
+  std::cout << "  " << std::left << std::setw(24) << "parse()" << std::right << std::setw(12) << std::fixed
+            << std::setprecision(1) << count / parseNs * 1e3 << " Mframes/s" << std::endl;
+  std::cout << "  " << std::left << std::setw(24) << "FrameView" << std::right << std::setw(12) << std::fixed
+            << std::setprecision(1) << count / viewNs * 1e3 << " Mframes/s" << std::setw(8) << std::setprecision(2)
+            << parseNs / viewNs << "x" << (sum == 0.0 ? " " : "") << std::endl;
+}
+
+EBP_FIELD_NAME(U8, "u8");
+EBP_FIELD_NAME(U16, "u16");
+EBP_FIELD_NAME(I16, "i16");
+EBP_FIELD_NAME(U32, "u32");
+EBP_FIELD_NAME(I32Scaled, "i32.scaled");
+EBP_FIELD_NAME(F, "f");
+EBP_FIELD_NAME(Flag, "flag");
+EBP_FIELD_NAME(BitsField, "bits");
+EBP_FIELD_NAME(U16BitsScaled, "u16.bits.scaled");
+
+/// makeBenchParser() as a compile-time schema.
+using BenchSchema =
+    Schema<Frame<32, 1, 2>, Field<U8, uint8_t, 1>, Field<U16, uint16_t, 3>, Field<I16, int16_t, 5, LittleEndian>,
+           Field<U32, uint32_t, 7, LittleEndian>,
+           Field<I32Scaled, int32_t, 11, BigEndian, NoBits, std::ratio<1, 4>, std::ratio<-3>>,
+           Field<F, float, 15, LittleEndian>, Field<Flag, bool, 19, BigEndian, Bits<3, 1>>,
+           Field<BitsField, int16_t, 20, BigEndian, Bits<4, 9>>,
+           Field<U16BitsScaled, uint16_t, 28, LittleEndian, Bits<2, 12>, std::ratio<1, 10>>>;
+
+void benchSchema() {
+  const size_t count = 1 << 20;
+  std::cout << "Decoding all 9 fields, " << count << " frames of 32 bytes" << std::endl;
+  ByteParser configured = makeBenchParser();
+  configured.compile();
+  const ByteParser& parser = configured;
+  std::vector<char> data = makeBenchFrames(count);
+
+  ParseResult result;
+  double parseNs = timeNs(
+      [&] {
+        for (size_t i = 0; i < count; ++i) parser.parse(data.data() + i * 32, 32, result);
+      },
+      1);
+  BenchSchema::Values values;
+  double sum = 0.0;
+  double checkedNs = timeNs(
+      [&] {
+        for (size_t i = 0; i < count; ++i) {
+          if (parser.check(data.data() + i * 32, 32) != FrameStatus::Ok) continue;
+          BenchSchema::decode(data.data() + i * 32, values);
+          sum += values.get<F>();
+        }
+      },
+      1);
+  double decodeNs = timeNs(
+      [&] {
+        for (size_t i = 0; i < count; ++i) {
+          BenchSchema::decode(data.data() + i * 32, values);
+          sum += values.get<F>();
+        }
+      },
+      1);
+  auto row = [&](const char* name, double ns) {
+    std::cout << "  " << std::left << std::setw(24) << name << std::right << std::setw(12) << std::fixed
+              << std::setprecision(1) << count / ns * 1e3 << " Mframes/s" << std::setw(8) << std::setprecision(2)
+              << parseNs / ns << "x" << std::endl;
+  };
+  row("parse()", parseNs);
+  row("check() + Schema", checkedNs);
+  row("Schema::decode()", decodeNs);
+  if (sum == 0.0) std::cout << std::endl;
+}
+
+void benchJit() {
+  const size_t count = 1 << 20;
+  std::cout << "Decoding all 9 fields without CRC, " << count << " frames of 32 bytes" << std::endl;
+  ByteParser interpreted = makeBenchParser();
+  interpreted.setCRC("", 0).compile();
+  ByteParser jitted = interpreted;
+  jitted.setJit(true).compile();
+  std::vector<char> data = makeBenchFrames(count);
+
+  ParseResult result;
+  FlatResult flat;
+  auto run = [&](const ByteParser& parser, auto& out) {
+    return timeNs(
+        [&] {
+          for (size_t i = 0; i < count; ++i) parser.parse(data.data() + i * 32, 32, out);
+        },
+        1);
+  };
+  const double parseNs = run(interpreted, result);
+  auto row = [&](const char* name, double ns) {
+    std::cout << "  " << std::left << std::setw(24) << name << std::right << std::setw(12) << std::fixed
+              << std::setprecision(1) << count / ns * 1e3 << " Mframes/s" << std::setw(8) << std::setprecision(2)
+              << parseNs / ns << "x" << std::endl;
+  };
+  row("ParseResult", parseNs);
+  row("FlatResult interpreted", run(interpreted, flat));
+  if (jitted.isJitActive())
+    row("FlatResult JIT", run(jitted, flat));
+  else
+    std::cout << "  JIT not available in this build" << std::endl;
+}
+
+}  // namespace
+
+int main() {
+  benchStartCodeScan();
+  benchParallelBatch();
+  benchConstParseThreads();
+  benchFrameView();
+  benchSchema();
+  benchJit();
+  return 0;
+}
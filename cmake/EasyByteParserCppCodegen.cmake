@@ -0,0 +1,42 @@
+# ebp_generate_decoder(<target> INI <config.ini> [NAME <StructName>] [NAMESPACE <namespace>] [OUTPUT <header>])
+#
+# Generates a decoder header from an INI configuration with ebp_codegen whenever the INI changes,
+# adds it to <target> and puts its directory on the include path of <target>.
+# The header is named after the INI (config.ini -> config.hpp) and written to
+# ${CMAKE_CURRENT_BINARY_DIR}/ebp_generated unless OUTPUT is given.
+function(ebp_generate_decoder target)
+  cmake_parse_arguments(EBP "" "INI;NAME;NAMESPACE;OUTPUT" "" ${ARGN})
+  if(NOT EBP_INI)
+    message(FATAL_ERROR "ebp_generate_decoder: INI is required")
+  endif()
+  if(NOT TARGET EasyByteParserCpp::ebp_codegen)
+    message(FATAL_ERROR "ebp_generate_decoder: ebp_codegen is not available (BUILD_CODEGEN=OFF?)")
+  endif()
+
+  get_filename_component(ini "${EBP_INI}" ABSOLUTE)
+  if(NOT EBP_OUTPUT)
+    get_filename_component(stem "${ini}" NAME_WE)
+    set(EBP_OUTPUT "${CMAKE_CURRENT_BINARY_DIR}/ebp_generated/${stem}.hpp")
+  endif()
+  get_filename_component(output "${EBP_OUTPUT}" ABSOLUTE BASE_DIR "${CMAKE_CURRENT_BINARY_DIR}")
+  get_filename_component(output_dir "${output}" DIRECTORY)
+
+  set(args "${ini}" "${output}")
+  if(EBP_NAME)
+    list(APPEND args --name "${EBP_NAME}")
+  endif()
+  if(EBP_NAMESPACE)
+    list(APPEND args --namespace "${EBP_NAMESPACE}")
+  endif()
+
+  add_custom_command(
+    OUTPUT "${output}"
+    COMMAND ${CMAKE_COMMAND} -E make_directory "${output_dir}"
+    COMMAND EasyByteParserCpp::ebp_codegen ${args}
+    DEPENDS "${ini}" EasyByteParserCpp::ebp_codegen
+    COMMENT "Generating decoder ${output} from ${EBP_INI}"
+    VERBATIM
+  )
+  target_sources(${target} PRIVATE "${output}")
+  target_include_directories(${target} PRIVATE "${output_dir}")
+endfunction()
@@ -1,14 +1,24 @@
 #pragma once
 
+#include <cassert>
 #include <cstdint>
+#include <cstring>
+#include <functional>
 #include <map>
+#include <memory>
 #include <stdexcept>
 #include <string>
 #include <type_traits>
+#include <unordered_map>
+#include <utility>
 #include <variant>
 #include <vector>
 
+#include "EasyByteParserCpp/Checksum.hpp"
+
 namespace easy_byte_parser {
+class WorkerPool;
+
 class ParsedValue {
  public:
   using ValueType = std::variant<uint64_t, int64_t, double, bool, std::string>;
@@ -37,7 +47,28 @@ class ParsedValue {
     return value_;
   }
 
+  /// Access the stored value without copying.
+  /// \return Pointer to the value, or nullptr if another type is stored
+  template <typename T>
+  [[nodiscard]] const T* getIf() const noexcept {
+    return std::get_if<T>(&value_);
+  }
+
+  /// Position of T in ValueType, used to type-check field handles.
+  template <typename T>
+  static constexpr size_t indexOf() {
+    return indexOf<T>(static_cast<ValueType*>(nullptr));
+  }
+
  private:
+  template <typename T, typename... Ts>
+  static constexpr size_t indexOf(std::variant<Ts...>*) {
+    constexpr bool matches[] = {std::is_same_v<T, Ts>...};
+    for (size_t i = 0; i < sizeof...(Ts); ++i)
+      if (matches[i]) return i;
+    return sizeof...(Ts);
+  }
+
   ValueType value_;
 };
 
@@ -80,14 +111,473 @@ struct TypeName<int32_t> {
   static constexpr const char* value = "int32";
 };
 template <>
+struct TypeName<uint64_t> {
+  static constexpr const char* value = "uint64";
+};
+template <>
+struct TypeName<int64_t> {
+  static constexpr const char* value = "int64";
+};
+template <>
 struct TypeName<float> {
   static constexpr const char* value = "float";
 };
 template <>
+struct TypeName<double> {
+  static constexpr const char* value = "double";
+};
+template <>
 struct TypeName<bool> {
   static constexpr const char* value = "bool";
 };
 
+/// Wire type of a field, decoded once from FieldDefinition::type.
+/// The 64-bit types follow Bool so that the values of the older types, which index Column, stay stable.
+enum class FieldType : uint8_t { UInt8, Int8, UInt16, Int16, UInt32, Int32, Float, Bool, UInt64, Int64, Double };
+
+/// Shape of a field's transform value = raw * scale + bias, classified once by ByteParser::compile().
+/// Decoding always applies the transform in double, which is exact for every kind; the kind tells
+/// consumers of raw integers (ByteParser::setRawIntegers()) which cheaper integer form is exact.
+enum class ScaleKind : uint8_t {
+  Identity,    // scale 1, bias 0 (and all bools)
+  Integer,     // Integral scale and bias, small enough for exact integer arithmetic on raws of up to 32 bits
+  PowerOfTwo,  // scale is +-2^exponent, raws of up to 32 bits
+  Affine       // Anything else, including every scaled raw wider than 32 bits
+};
+
+/// Fixed-point conversion of raw integers to Q-format with integer arithmetic only, from Affine::fixedPoint():
+/// apply(raw) = (raw * multiplier + offset) >> shift ~= round((raw * scale + bias) * 2^fractionalBits).
+/// Parameters are small enough for raw values of up to 32 bits not to overflow int64_t; wider raws are rejected.
+struct FixedPoint {
+  int64_t multiplier = 1;
+  int64_t offset = 0;  // Bias plus the rounding half
+  unsigned shift = 0;
+  unsigned fractionalBits = 0;
+  bool exact = true;  // apply() equals the rounded value for every raw value, not only within 1 LSB
+
+  [[nodiscard]] int64_t apply(int64_t raw) const {
+    return (raw * multiplier + offset) >> shift;  // Arithmetic shift: floors negative values
+  }
+};
+
+/// Transform of a field from its raw integer to its value, see ByteParser::affine().
+struct Affine {
+  ScaleKind kind = ScaleKind::Identity;
+  double scale = 1.0;
+  double bias = 0.0;
+  int64_t integerScale = 1;  // kind Identity / Integer: scale as integer
+  int64_t integerBias = 0;   // kind Identity / Integer: bias as integer
+  int exponent = 0;          // kind PowerOfTwo: |scale| == 2^exponent
+  unsigned rawBits = 32;     // Significant bits of the raw value (bit count of bit fields)
+
+  /// The value parse() produces for \p raw without raw output, bit for bit.
+  [[nodiscard]] double apply(double raw) const {
+    return kind == ScaleKind::Identity ? raw : raw * scale + bias;
+  }
+
+  /// Raw equivalent of a value, e.g. to compare raw integers against a threshold converted once
+  /// (for scale > 0: value > t <=> raw > toRaw(t), up to the rounding of apply()).
+  [[nodiscard]] double toRaw(double value) const {
+    return (value - bias) / scale;
+  }
+
+  /// Integer-only Q-format conversion with \p fractionalBits fraction bits.
+  /// Exact for Identity, Integer and PowerOfTwo transforms whose bias fits the format.
+  /// Throws std::out_of_range if the scaled values cannot be represented or rawBits exceeds 32.
+  [[nodiscard]] FixedPoint fixedPoint(unsigned fractionalBits) const;
+};
+
+/// One pre-decoded extraction step of a CompiledLayout.
+/// All string work (type names, endianness) is resolved when the layout is compiled.
+struct FieldOp {
+  FieldType type = FieldType::UInt8;
+  size_t byteOffset = 0;
+  uint8_t shift = 0;           // Bit offset inside the raw value
+  uint64_t mask = 0;           // Bit mask applied after shifting, 0 if the field is not a bit field
+  bool byteSwap = false;       // Source endianness differs from the host
+  bool needsScaling = false;   // Scaling is applied: scale != 1.0 || bias != 0.0, and no raw output
+  ScaleKind scaleKind = ScaleKind::Identity;
+  double scale = 1.0;
+  double bias = 0.0;
+};
+
+/// Comparison of a filter predicate.
+enum class CompareOp : uint8_t { Eq, Ne, Lt, Le, Gt, Ge };
+
+/// Predicate on the numeric value of a field (after bit extraction and scaling, bools as 0 / 1).
+/// Frames are kept only if all predicates hold.
+struct FilterDefinition {
+  std::string field;
+  CompareOp op = CompareOp::Eq;
+  double value = 0.0;
+};
+
+/// Compiled predicate of a CompiledLayout, reading its field straight from the frame bytes.
+struct FilterOp {
+  FieldOp field;
+  CompareOp op = CompareOp::Eq;
+  double value = 0.0;
+};
+
+/// Machine code decoding a frame into the slots of a FlatResult, see ByteParser::setJit().
+using FlatDecodeFn = void (*)(const char* frame, uint64_t* slots);
+
+/// Flat execution plan lowered from the field definitions by ByteParser::compile().
+struct CompiledLayout {
+  std::vector<FilterOp> filters;  // Evaluated before the CRC check and any decoding
+  std::vector<FieldOp> ops;
+  std::vector<std::string> names;                  // names[i] is the field name of ops[i]
+  std::unordered_map<std::string, size_t> index;  // Field name -> ordinal in ops
+  FlatDecodeFn flatDecode = nullptr;              // JIT-compiled decoder, nullptr: interpreted
+  std::shared_ptr<const void> jitCode;            // Owns the code of flatDecode
+};
+
+/// Typed handle to a parsed field, resolved once by ByteParser::fieldHandle<T>().
+/// T is the type stored in ParsedValue for that field: uint64_t, int64_t, double or bool.
+/// A handle stays valid as long as the parser configuration does not change.
+template <typename T>
+class FieldHandle {
+ public:
+  FieldHandle() = default;
+
+  [[nodiscard]] size_t index() const {
+    return index_;
+  }
+
+ private:
+  friend class ByteParser;
+
+  explicit FieldHandle(size_t index) : index_(index) {}
+
+  size_t index_ = 0;
+};
+
+/// Outcome of parsing a single frame in batch mode.
+/// Filtered: rejected by a filter predicate, evaluated before the CRC check.
+enum class FrameStatus : uint8_t { Ok, InvalidStartCode, CrcMismatch, TooShort, Filtered };
+
+/// Reusable parse output holding one value per field, indexed by field ordinal.
+/// Sized once from the compiled layout and overwritten in place by ByteParser::parse(),
+/// so parsing into an existing ParseResult does not allocate.
+class ParseResult {
+ public:
+  ParseResult() = default;
+
+  [[nodiscard]] size_t size() const {
+    return values_.size();
+  }
+
+  /// Value of the field with the given ordinal (order of definition).
+  const ParsedValue& operator[](size_t index) const {
+    return values_[index];
+  }
+
+  /// Value of the field with the given name.
+  /// Throws std::out_of_range if no such field exists.
+  [[nodiscard]] const ParsedValue& at(const std::string& name) const;
+
+  /// Name of the field with the given ordinal.
+  [[nodiscard]] const std::string& nameAt(size_t index) const {
+    return layout_->names[index];
+  }
+
+  [[nodiscard]] const std::vector<ParsedValue>& values() const {
+    return values_;
+  }
+
+  /// Typed access through a handle: an indexed load without lookup, copy or exception.
+  /// The handle must come from the parser that filled this result (checked by assert in debug builds).
+  template <typename T>
+  [[nodiscard]] const T& get(FieldHandle<T> handle) const noexcept {
+    assert(handle.index() < values_.size() && values_[handle.index()].template getIf<T>());
+    return *values_[handle.index()].template getIf<T>();
+  }
+
+  /// Convert to the name keyed map returned by ByteParser::parse(const char*, size_t).
+  [[nodiscard]] std::map<std::string, ParsedValue> toMap() const;
+
+ private:
+  friend class ByteParser;
+
+  std::shared_ptr<const CompiledLayout> layout_;
+  std::vector<ParsedValue> values_;
+};
+
+/// Lazy view of one frame returned by ByteParser::view(): the frame pointer plus the compiled layout.
+/// Nothing is decoded up front; each access decodes only the requested field from the frame bytes,
+/// so reading a few fields of a wide frame costs a few loads instead of a full parse().
+/// The view does not own the frame, which must outlive it. It keeps its layout alive, so it stays
+/// usable after the parser is reconfigured, with the field ordinals of the layout it was created with.
+class FrameView {
+ public:
+  FrameView() = default;
+
+  /// Number of fields of the layout.
+  [[nodiscard]] size_t size() const {
+    return layout_ ? layout_->ops.size() : 0;
+  }
+
+  /// Start of the frame.
+  [[nodiscard]] const char* data() const {
+    return data_;
+  }
+
+  /// Decode the field with the given ordinal (order of definition).
+  ParsedValue operator[](size_t index) const;
+
+  /// Decode the field with the given name.
+  /// Throws std::out_of_range if no such field exists.
+  [[nodiscard]] ParsedValue at(const std::string& name) const;
+
+  /// Name of the field with the given ordinal.
+  [[nodiscard]] const std::string& nameAt(size_t index) const {
+    return layout_->names[index];
+  }
+
+  /// Typed access through a handle: decodes the one field, without lookup or exception.
+  /// The handle must come from the parser that created this view (checked by assert in debug builds).
+  template <typename T>
+  [[nodiscard]] T get(FieldHandle<T> handle) const noexcept {
+    assert(handle.index() < size());
+    const ParsedValue value = (*this)[handle.index()];
+    assert(value.template getIf<T>());
+    return *value.template getIf<T>();
+  }
+
+ private:
+  friend class ByteParser;
+
+  const char* data_ = nullptr;
+  std::shared_ptr<const CompiledLayout> layout_;
+};
+
+/// Reusable parse output with one 8-byte slot per field, indexed by field ordinal.
+/// Slot i holds the raw bits of the value ParseResult would store for field i: uint64_t, int64_t,
+/// double, or a bool as 0 / 1. Being plain memory, it can be filled by JIT-compiled code (see
+/// ByteParser::setJit()) and read without variant dispatch.
+class FlatResult {
+ public:
+  FlatResult() = default;
+
+  [[nodiscard]] size_t size() const {
+    return slots_.size();
+  }
+
+  /// Value of the field with the given ordinal, converted to a ParsedValue.
+  ParsedValue operator[](size_t index) const;
+
+  /// Name of the field with the given ordinal.
+  [[nodiscard]] const std::string& nameAt(size_t index) const {
+    return layout_->names[index];
+  }
+
+  /// The slots, size() entries.
+  [[nodiscard]] const uint64_t* data() const {
+    return slots_.data();
+  }
+
+  /// Typed access through a handle: one load, without lookup or exception.
+  template <typename T>
+  [[nodiscard]] T get(FieldHandle<T> handle) const noexcept {
+    assert(handle.index() < slots_.size());
+    if constexpr (std::is_same_v<T, bool>) {
+      return slots_[handle.index()] != 0;
+    } else {
+      T value;
+      std::memcpy(&value, &slots_[handle.index()], sizeof(T));
+      return value;
+    }
+  }
+
+ private:
+  friend class ByteParser;
+
+  std::shared_ptr<const CompiledLayout> layout_;
+  std::vector<uint64_t> slots_;
+};
+
+/// Reusable output of ByteParser::parseBatch(): the values of all frames in one flat,
+/// frame-major array plus a status per frame. Storage only grows, so parsing batches of
+/// the same or smaller size into an existing BatchResult does not allocate.
+/// Values of frames whose status is not FrameStatus::Ok are unspecified, but always hold
+/// the type of their field, so get() through a FieldHandle is valid for every frame.
+class BatchResult {
+ public:
+  BatchResult() = default;
+
+  /// Number of frames in the last batch.
+  [[nodiscard]] size_t size() const {
+    return status_.size();
+  }
+
+  [[nodiscard]] size_t fieldCount() const {
+    return fieldCount_;
+  }
+
+  [[nodiscard]] FrameStatus status(size_t frame) const {
+    return status_[frame];
+  }
+
+  [[nodiscard]] const std::vector<FrameStatus>& statuses() const {
+    return status_;
+  }
+
+  /// Number of frames parsed with FrameStatus::Ok.
+  [[nodiscard]] size_t okCount() const {
+    return okCount_;
+  }
+
+  /// Indexes of the frames with FrameStatus::Ok, ascending.
+  [[nodiscard]] const std::vector<size_t>& selection() const {
+    return selection_;
+  }
+
+  /// Value of the field with the given ordinal in the given frame.
+  [[nodiscard]] const ParsedValue& value(size_t frame, size_t field) const {
+    return values_[frame * fieldCount_ + field];
+  }
+
+  /// Value of the field with the given name in the given frame.
+  /// Throws std::out_of_range if no such field exists.
+  [[nodiscard]] const ParsedValue& at(size_t frame, const std::string& name) const;
+
+  /// Typed access through a handle, valid for every frame of the batch.
+  /// The handle must come from the parser that filled this batch (checked by assert in debug builds).
+  template <typename T>
+  [[nodiscard]] const T& get(size_t frame, FieldHandle<T> handle) const noexcept {
+    assert(frame < size() && handle.index() < fieldCount_ && value(frame, handle.index()).template getIf<T>());
+    return *value(frame, handle.index()).template getIf<T>();
+  }
+
+ private:
+  friend class ByteParser;
+
+  std::shared_ptr<const CompiledLayout> layout_;
+  size_t fieldCount_ = 0;
+  size_t okCount_ = 0;
+  std::vector<ParsedValue> values_;
+  std::vector<FrameStatus> status_;
+  std::vector<size_t> selection_;
+};
+
+/// Packed bit column holding the values of a bool field in a ColumnarBatch.
+class BitColumn {
+ public:
+  [[nodiscard]] size_t size() const {
+    return size_;
+  }
+
+  bool operator[](size_t index) const {
+    return (words_[index >> 6] >> (index & 63)) & 1;
+  }
+
+  /// Packed storage, bit i of the column is bit (i % 64) of word i / 64.
+  [[nodiscard]] const std::vector<uint64_t>& words() const {
+    return words_;
+  }
+
+  [[nodiscard]] std::vector<uint64_t>& words() {
+    return words_;
+  }
+
+  /// Resize to \p size bits. Keeps the capacity when shrinking.
+  void resize(size_t size) {
+    words_.resize((size + 63) / 64);
+    size_ = size;
+  }
+
+ private:
+  std::vector<uint64_t> words_;
+  size_t size_ = 0;
+};
+
+/// Contiguous values of one field across all frames of a ColumnarBatch.
+/// Integers keep their wire width (bit fields become unsigned), floats and scaled fields are
+/// stored as double and bools as a packed BitColumn. Alternatives follow the FieldType order,
+/// double fields share the column of floats.
+using Column = std::variant<std::vector<uint8_t>, std::vector<int8_t>, std::vector<uint16_t>, std::vector<int16_t>,
+                            std::vector<uint32_t>, std::vector<int32_t>, std::vector<double>, BitColumn,
+                            std::vector<uint64_t>, std::vector<int64_t>>;
+
+/// Structure-of-arrays output of ByteParser::parseBatch(): one typed column per field plus a
+/// status per frame. Columns only grow, so reusing a ColumnarBatch across batches does not allocate.
+/// Values of frames whose status is not FrameStatus::Ok are unspecified.
+class ColumnarBatch {
+ public:
+  ColumnarBatch() = default;
+
+  /// Number of frames in the last batch.
+  [[nodiscard]] size_t size() const {
+    return status_.size();
+  }
+
+  [[nodiscard]] size_t columnCount() const {
+    return columns_.size();
+  }
+
+  [[nodiscard]] FrameStatus status(size_t frame) const {
+    return status_[frame];
+  }
+
+  [[nodiscard]] const std::vector<FrameStatus>& statuses() const {
+    return status_;
+  }
+
+  [[nodiscard]] size_t okCount() const {
+    return okCount_;
+  }
+
+  /// Indexes of the frames with FrameStatus::Ok, ascending.
+  [[nodiscard]] const std::vector<size_t>& selection() const {
+    return selection_;
+  }
+
+  /// Column of the field with the given ordinal. Only the first size() entries are valid.
+  [[nodiscard]] const Column& column(size_t field) const {
+    return columns_[field];
+  }
+
+  /// Column of the field with the given name.
+  /// Throws std::out_of_range if no such field exists.
+  [[nodiscard]] const Column& column(const std::string& name) const;
+
+  /// Typed column access. Throws std::bad_variant_access if the column holds another type.
+  template <typename T>
+  [[nodiscard]] const std::vector<T>& column(size_t field) const {
+    return std::get<std::vector<T>>(columns_[field]);
+  }
+
+  [[nodiscard]] const BitColumn& bits(size_t field) const {
+    return std::get<BitColumn>(columns_[field]);
+  }
+
+ private:
+  friend class ByteParser;
+
+  std::shared_ptr<const CompiledLayout> layout_;
+  size_t okCount_ = 0;
+  std::vector<Column> columns_;
+  std::vector<FrameStatus> status_;
+  std::vector<size_t> selection_;
+};
+
+/// Summary of ByteParser::parseFile().
+struct FileParseStats {
+  size_t frames = 0;         // Frames passed to the sink, including ones with a non-Ok status
+  size_t okFrames = 0;       // Frames with FrameStatus::Ok
+  size_t bytes = 0;          // Size of the file
+  size_t trailingBytes = 0;  // Bytes after the last complete frame, not parsed
+  double seconds = 0.0;      // Wall time of mapping and parsing, including the sink
+
+  [[nodiscard]] double framesPerSecond() const {
+    return seconds > 0.0 ? frames / seconds : 0.0;
+  }
+
+  [[nodiscard]] double megabytesPerSecond() const {
+    return seconds > 0.0 ? bytes / seconds / 1e6 : 0.0;
+  }
+};
+
 class ByteParser {
  public:
   ByteParser() = default;
@@ -107,8 +597,63 @@ class ByteParser {
   ByteParser& setStartCode(const std::vector<uint8_t>& code, size_t length);
 
   /// Set the CRC algorithm and validation field length.
+  /// \param algo Name of an algorithm registered in checksum::, e.g. "CRC16", "CRC32C" or "SUM8"
+  /// \param length Size of the checksum field at the end of the frame, must match the algorithm
   ByteParser& setCRC(const std::string& algo, size_t length);
 
+  /// Set the byte order of the received checksum field (default: little endian).
+  ByteParser& setCRCEndian(bool isBigEndian);
+
+  /// Restrict the checksum to the bytes [start, end) of the frame.
+  /// \param start First covered byte (default 0)
+  /// \param end One past the last covered byte, 0 for "up to the checksum field" (default)
+  ByteParser& setCRCRange(size_t start, size_t end = 0);
+
+  /// Add a filter predicate. Frames for which it does not hold get FrameStatus::Filtered
+  /// and are neither CRC-checked nor decoded; parse() throws for them.
+  /// \param field Name of a field of the configuration
+  /// \param op Comparison of the field value against \p value
+  /// \param value Right-hand side of the comparison
+  ByteParser& addFilter(const std::string& field, CompareOp op, double value);
+
+  /// addFilter() with the comparison given as "==", "!=", "<", "<=", ">" or ">=".
+  ByteParser& addFilter(const std::string& field, const std::string& op, double value);
+
+  /// Remove all filter predicates.
+  ByteParser& clearFilters();
+
+  /// Decode FlatResults with machine code generated for the compiled layout (x86-64, POSIX).
+  /// The code is generated by compile(); where the build (ENABLE_JIT=OFF) or platform does not
+  /// support it, the interpreted plan is used. Kept by clear() and loadConfig().
+  ByteParser& setJit(bool enabled);
+
+  [[nodiscard]] bool isJitEnabled() const {
+    return jit_;
+  }
+
+  /// True if the compiled layout has JIT-compiled code.
+  [[nodiscard]] bool isJitActive() const {
+    return isCompiled() && layout_->flatDecode != nullptr;
+  }
+
+  /// Raw output: integer fields (including bit fields) keep their raw value as uint64_t / int64_t
+  /// in every parse mode instead of the scaled double, so consumers comparing thresholds never
+  /// convert to double. affine() describes how to get the value. Floats are still scaled and
+  /// filters still compare values. Kept by clear() and loadConfig().
+  ByteParser& setRawIntegers(bool enabled);
+
+  [[nodiscard]] bool isRawIntegers() const {
+    return rawIntegers_;
+  }
+
+  /// Scale and bias of a field as classified by compile().
+  /// Throws std::runtime_error if the field does not exist.
+  Affine affine(const std::string& name);
+
+  /// Const overload for a parser shared after compile().
+  /// Throws std::runtime_error if the configuration changed since compile().
+  [[nodiscard]] Affine affine(const std::string& name) const;
+
   /// Manually add a field definition.
   ByteParser& addField(const FieldDefinition& definition);
 
@@ -129,6 +674,34 @@ class ByteParser {
     return addField(fd);
   }
 
+  /// Projection: a compiled copy of this parser that decodes only the given fields, in the given order.
+  /// Frame checks (StartCode, CRC) are unchanged; unselected fields are neither decoded, scaled nor
+  /// stored, in every parse mode. Field ordinals and handles refer to the projection.
+  /// Throws std::out_of_range for an unknown field name.
+  /// Usage: ByteParser rpmOnly = parser.select({"rpm", "temp.engine_oil"});
+  [[nodiscard]] ByteParser select(const std::vector<std::string>& names) const;
+
+  /// Resolve a typed handle for fast access to a field of ParseResult, BatchResult or FrameView.
+  /// Throws std::runtime_error if the field does not exist or is not stored as T.
+  /// Precondition of every get(handle): the result was filled by this parser (or a copy with the same
+  /// layout) and the handle was resolved after the last configuration change. Reads skip the type
+  /// check for speed; debug builds assert it.
+  /// Usage: auto h = parser.fieldHandle<double>("MyFloat"); double v = result.get(h);
+  template <typename T>
+  FieldHandle<T> fieldHandle(const std::string& name) {
+    compile();
+    return std::as_const(*this).template fieldHandle<T>(name);
+  }
+
+  /// Const overload for a parser shared after compile().
+  /// Throws std::runtime_error if the configuration changed since compile().
+  template <typename T>
+  [[nodiscard]] FieldHandle<T> fieldHandle(const std::string& name) const {
+    static_assert(ParsedValue::indexOf<T>() < std::variant_size_v<ParsedValue::ValueType>,
+                  "FieldHandle type must be one of ParsedValue::ValueType");
+    return FieldHandle<T>(resolveField(name, ParsedValue::indexOf<T>()));
+  }
+
   /// Clear all current configurations.
   void clear();
 
@@ -136,6 +709,11 @@ class ByteParser {
   /// Called automatically by parse() if configuration changed.
   void validateConfig() const;
 
+  /// Validate the configuration and lower the field definitions into a CompiledLayout.
+  /// Only does work if the configuration changed since the last successful call.
+  /// \return The compiled layout used by parse()
+  const CompiledLayout& compile();
+
   // ------------------------
 
   /// Parse a byte buffer according to loaded configuration.
@@ -150,8 +728,101 @@ class ByteParser {
   /// \return Map of parsed values
   std::map<std::string, ParsedValue> parse(const char* data, size_t size);
 
+  /// Parse a byte buffer into a reusable result, overwriting its previous values.
+  /// Does not allocate once \p result has been sized for the current layout.
+  /// \param data Pointer to data buffer
+  /// \param size Size of data buffer
+  /// \param result Output, resized automatically if the layout changed
+  void parse(const char* data, size_t size, ParseResult& result);
+
+  /// Check a frame (size, StartCode, filters, CRC) and return a lazy view of it instead of decoding it.
+  /// Throws std::runtime_error like parse() if the check fails.
+  /// Usage: double rpm = parser.view(data, size).get(rpmHandle);
+  FrameView view(const char* data, size_t size);
+
+  /// Parse a byte buffer into a reusable FlatResult, with the JIT-compiled decoder if active.
+  void parse(const char* data, size_t size, FlatResult& result);
+
+  /// Parse \p count back-to-back frames of getTotalLength() bytes, the i-th starting at data + i * stride.
+  /// Frames failing the StartCode or CRC check are reported in BatchResult::statuses() instead of throwing.
+  /// Throws std::runtime_error only for errors affecting the whole batch (invalid config, stride too small).
+  /// \param data Pointer to the first frame
+  /// \param count Number of frames
+  /// \param stride Distance in bytes between the starts of consecutive frames
+  /// \param result Output, reused across calls
+  void parseBatch(const char* data, size_t count, size_t stride, BatchResult& result);
+
+  /// Columnar variant of parseBatch(): each field is decoded into its own contiguous typed column.
+  void parseBatch(const char* data, size_t count, size_t stride, ColumnarBatch& result);
+
+  /// Parallel variant of parseBatch(): the frames are split into chunks that the threads of
+  /// \p pool decode directly into their slice of \p result, so the output is in input order.
+  void parseBatch(const char* data, size_t count, size_t stride, BatchResult& result, WorkerPool& pool);
+
+  /// Parallel variant of the columnar parseBatch().
+  void parseBatch(const char* data, size_t count, size_t stride, ColumnarBatch& result, WorkerPool& pool);
+
+  // --- Const parse path ---
+  // compile() (also run by loadConfig()) freezes the parser until the next configuration change.
+  // The const overloads only read the compiled layout, so one frozen parser can be shared by any
+  // number of threads through a const reference without locks, each thread with its own results.
+  // They throw std::runtime_error if the configuration changed since the last compile().
+
+  std::map<std::string, ParsedValue> parse(const std::vector<char>& buffer) const;
+  std::map<std::string, ParsedValue> parse(const char* data, size_t size) const;
+  void parse(const char* data, size_t size, ParseResult& result) const;
+
+  /// Like parse(), but a frame failing the size, StartCode or CRC check is reported instead of thrown.
+  /// \return FrameStatus::Ok if \p result was filled
+  FrameStatus tryParse(const char* data, size_t size, ParseResult& result) const;
+
+  void parse(const char* data, size_t size, FlatResult& result) const;
+  FrameStatus tryParse(const char* data, size_t size, FlatResult& result) const;
+
+  FrameView view(const char* data, size_t size) const;
+
+  /// Size, StartCode, filter and CRC check of a frame without decoding it, e.g. before Schema::decode().
+  [[nodiscard]] FrameStatus check(const char* data, size_t size) const;
+
+  /// Like view(), but a frame failing the checks is reported instead of thrown.
+  /// Re-pointing an existing view at a frame of the same layout does not touch the reference count.
+  /// \return FrameStatus::Ok if \p view was set to the frame
+  FrameStatus tryView(const char* data, size_t size, FrameView& view) const;
+
+  void parseBatch(const char* data, size_t count, size_t stride, BatchResult& result) const;
+  void parseBatch(const char* data, size_t count, size_t stride, ColumnarBatch& result) const;
+  void parseBatch(const char* data, size_t count, size_t stride, BatchResult& result, WorkerPool& pool) const;
+  void parseBatch(const char* data, size_t count, size_t stride, ColumnarBatch& result, WorkerPool& pool) const;
+
+  /// True if the configuration is compiled and unchanged since, i.e. the const parse path is usable.
+  [[nodiscard]] bool isCompiled() const {
+    return !dirty_ && layout_;
+  }
+
+  /// Receives the batches of parseFile(), \p firstFrame being the index of the batch's frame 0 in the file.
+  using BatchSink = std::function<void(const BatchResult& batch, size_t firstFrame)>;
+  using ColumnarSink = std::function<void(const ColumnarBatch& batch, size_t firstFrame)>;
+
+  /// Parse a capture file of back-to-back frames of getTotalLength() bytes.
+  /// The file is memory-mapped and frames are parsed directly from the mapping, \p framesPerBatch
+  /// at a time, into one batch that is reused for every call of \p sink.
+  /// Throws std::runtime_error if the file cannot be opened or mapped.
+  /// \param path Capture file
+  /// \param sink Called once per batch, in file order
+  /// \param framesPerBatch Frames per batch, at least 1
+  /// \param pool If set, each batch is parsed in parallel on the pool
+  /// \return Frame counts and throughput
+  FileParseStats parseFile(const std::string& path, const BatchSink& sink, size_t framesPerBatch = 4096,
+                           WorkerPool* pool = nullptr);
+
+  /// Columnar variant of parseFile().
+  FileParseStats parseFile(const std::string& path, const ColumnarSink& sink, size_t framesPerBatch = 4096,
+                           WorkerPool* pool = nullptr);
+
   static std::string dumpRaw(const std::map<std::string, ParsedValue>& data);
   static std::string dumpJson(const std::map<std::string, ParsedValue>& data);
+  static std::string dumpRaw(const ParseResult& data);
+  static std::string dumpJson(const ParseResult& data);
 
   /// Generate a visual checklist of the current configuration.
   [[nodiscard]] std::string getConfigurationChecklist() const;
@@ -176,12 +847,110 @@ class ByteParser {
     return crcLength_;
   }
 
+  [[nodiscard]] bool isCRCBigEndian() const {
+    return crcBigEndian_;
+  }
+
+  [[nodiscard]] size_t getCRCStart() const {
+    return crcStart_;
+  }
+
+  /// Field definitions, in order of definition.
+  [[nodiscard]] const std::vector<FieldDefinition>& getFields() const {
+    return fields_;
+  }
+
+  [[nodiscard]] const std::vector<FilterDefinition>& getFilters() const {
+    return filters_;
+  }
+
+  /// Effective end of the checksum coverage, TotalLength - CRCLength unless set explicitly.
+  /// 0 while CRCLength exceeds TotalLength, a configuration validateConfig() rejects.
+  [[nodiscard]] size_t getCRCEnd() const {
+    if (crcEnd_) return crcEnd_;
+    return crcLength_ > totalLength_ ? 0 : totalLength_ - crcLength_;
+  }
+
  private:
+  friend class StreamFramer;
+
+  /// Ordinal of a field after checking that it is stored as the given ValueType alternative.
+  size_t resolveField(const std::string& name, size_t valueIndex) const;
+
+  /// Check buffer size, StartCode and CRC of a single frame. Throws on mismatch.
+  void verifyFrame(const char* data, size_t size) const;
+
+  /// StartCode, filter and CRC check of a frame known to hold at least TotalLength bytes.
+  [[nodiscard]] FrameStatus checkFrame(const char* data) const;
+
+  /// CRC check only, for frames whose StartCode already matched. Ignores the filters.
+  [[nodiscard]] FrameStatus checkCrc(const char* data) const;
+
+  /// True if the frame passes all filter predicates.
+  [[nodiscard]] bool passesFilters(const char* data) const;
+
+  /// checkFrame() preceded by the buffer size check.
+  [[nodiscard]] FrameStatus checkFrame(const char* data, size_t size) const;
+
+  /// Batch-level checks shared by the parseBatch() overloads.
+  void checkBatch(size_t stride) const;
+
+  /// Decode a frame that passed checkFrame() with the compiled layout.
+  void decodeFrame(const char* data, ParseResult& result) const;
+  void decodeFrame(const char* data, FlatResult& result) const;
+
+  /// Definition of a decoded or filter-only field, nullptr if there is none.
+  [[nodiscard]] const FieldDefinition* findFieldDefinition(const std::string& name) const;
+
+  /// Throws unless isCompiled().
+  void requireCompiled() const;
+
+  /// Parse the frames [begin, end) of a batch prepared with prepareBatch().
+  /// \return Number of frames with FrameStatus::Ok
+  size_t parseRows(const char* data, size_t begin, size_t end, size_t stride, BatchResult& result) const;
+
+  /// Size \p result for \p count frames of the compiled layout.
+  void prepareColumns(size_t count, ColumnarBatch& result) const;
+
+  /// Parse the frames [begin, end) of a batch of \p count frames prepared with prepareColumns().
+  /// \p begin must be a multiple of 64.
+  /// \return Number of frames with FrameStatus::Ok
+  size_t parseColumns(const char* data, size_t begin, size_t end, size_t count, size_t stride,
+                      ColumnarBatch& result) const;
+
+  /// Split \p count frames into chunks parsed by parseRange(begin, end) on \p pool.
+  /// \return Sum of the Ok counts returned by parseRange
+  template <typename ParseRange>
+  size_t runParallel(size_t count, WorkerPool& pool, ParseRange&& parseRange) const;
+
+  /// Size \p result for \p count frames of the compiled layout.
+  void prepareBatch(size_t count, BatchResult& result) const;
+
+  /// Decode frames that passed checkFrame(), the i-th starting at frames[i].
+  void decodeFrames(const char* const* frames, size_t count, BatchResult& result) const;
+
+  /// Shared implementation of the parseFile() overloads.
+  template <typename Batch, typename Sink>
+  FileParseStats parseFileInto(const std::string& path, const Sink& sink, size_t framesPerBatch, WorkerPool* pool);
+
+  /// Checksum of a frame as calculated over the coverage range and as received in the checksum field.
+  void checksumOf(const char* data, uint32_t& calculated, uint32_t& received) const;
+
   std::vector<uint8_t> startCode_;
   size_t startCodeLength_ = 0;
   size_t totalLength_ = 0;
   std::string crcAlgo_;
   size_t crcLength_ = 0;
+  bool crcBigEndian_ = false;
+  size_t crcStart_ = 0;
+  size_t crcEnd_ = 0;  // 0: up to the checksum field
+  std::shared_ptr<const ChecksumAlgorithm> checksum_;  // Resolved from crcAlgo_ by compile()
   std::vector<FieldDefinition> fields_;
+  std::vector<FilterDefinition> filters_;
+  std::vector<FieldDefinition> filterFields_;  // Fields only read by filters, left out by select()
+  std::shared_ptr<const CompiledLayout> layout_;
+  bool jit_ = false;
+  bool rawIntegers_ = false;
+  bool dirty_ = true;  // Configuration changed since the last compile()
 };
 }  // namespace easy_byte_parser
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace easy_byte_parser {
+
+/// Checksum algorithm selectable by name through CRCAlgo= or ByteParser::setCRC().
+struct ChecksumAlgorithm {
+  std::string name;
+  size_t length = 0;  // Size of the checksum field in bytes (1 to 4)
+  std::function<uint32_t(const uint8_t* data, size_t length)> compute;
+};
+
+/// Registry of checksum algorithms.
+/// Built in: CRC16 (alias of CRC16-MODBUS), CRC16-MODBUS, CRC16-CCITT (CCITT-FALSE, init 0xFFFF),
+/// CRC16-XMODEM, CRC32, CRC32C (SSE4.2 crc32 instruction when available), SUM8 and XOR8.
+namespace checksum {
+
+/// Register an algorithm, replacing any previous one with the same name.
+/// Parsers pick up the new definition the next time their configuration is compiled.
+/// Throws std::runtime_error if the name is empty, the length is not 1 to 4 or compute is not set.
+void registerAlgorithm(ChecksumAlgorithm algorithm);
+
+/// Look up an algorithm by name.
+/// \return The algorithm, or nullptr if no algorithm with this name is registered
+std::shared_ptr<const ChecksumAlgorithm> find(const std::string& name);
+
+/// Names of all registered algorithms, sorted.
+std::vector<std::string> names();
+
+}  // namespace checksum
+}  // namespace easy_byte_parser
@@ -0,0 +1,112 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <thread>
+
+#include "EasyByteParserCpp/ByteParser.hpp"
+#include "EasyByteParserCpp/Queues.hpp"
+
+namespace easy_byte_parser {
+
+/// One frame travelling from the receive stage to the parse stage.
+/// The bytes are not copied: they must stay valid until the parse stage has consumed the slice,
+/// e.g. until ParseStage::stats().consumed passes its sequence number.
+struct FrameSlice {
+  const char* data = nullptr;
+  size_t size = 0;
+  uint64_t sequence = 0;  // Assigned by the producer, passed on to ParsedFrame
+};
+
+/// Output of the parse stage.
+struct ParsedFrame {
+  uint64_t sequence = 0;
+  FrameStatus status = FrameStatus::Ok;
+  ParseResult result;  // Unspecified if status is not FrameStatus::Ok
+};
+
+/// Counters of a ParseStage, readable from any thread.
+struct StageStats {
+  std::atomic<uint64_t> consumed{0};    // Slices taken from the input queue
+  std::atomic<uint64_t> invalid{0};     // Slices too short or failing the StartCode / CRC check
+  std::atomic<uint64_t> filtered{0};    // Slices rejected by a filter predicate, not published
+  std::atomic<uint64_t> outputFull{0};  // Times the stage waited because the output queue was full
+  std::atomic<uint64_t> inputEmpty{0};  // Polls that found the input queue empty
+};
+
+/// Parse stage between two queues (SpscQueue or MpmcQueue): takes FrameSlice from \p In,
+/// parses it through a compiled, const ByteParser and publishes ParsedFrame to \p Out.
+/// Several stages may share one parser; with MpmcQueue several stages may also share queues.
+/// Frames rejected by a filter of the parser are counted in StageStats::filtered and dropped.
+/// When the output queue is full the stage keeps the parsed frame and stops taking input,
+/// so backpressure propagates to the producer (visible in its queue's fullCount()).
+template <typename In, typename Out>
+class ParseStage {
+ public:
+  /// Throws std::runtime_error if \p parser is not compiled.
+  ParseStage(const ByteParser& parser, In& input, Out& output) : parser_(parser), input_(input), output_(output) {
+    if (!parser.isCompiled()) throw std::runtime_error("[EasyByteParserCpp]: ParseStage needs a compiled parser");
+  }
+
+  /// Process up to \p maxFrames available slices without blocking.
+  /// \return Number of frames published to the output queue
+  size_t poll(size_t maxFrames = SIZE_MAX) {
+    size_t published = 0;
+    while (published < maxFrames) {
+      if (!pending_) {
+        if (!input_.tryPop(slice_)) {
+          stats_.inputEmpty.fetch_add(1, std::memory_order_relaxed);
+          break;
+        }
+        stats_.consumed.fetch_add(1, std::memory_order_relaxed);
+        if (!parseSlice()) continue;
+        pending_ = true;
+      }
+      if (!output_.tryPush(frame_)) {
+        stats_.outputFull.fetch_add(1, std::memory_order_relaxed);
+        break;
+      }
+      pending_ = false;
+      ++published;
+    }
+    return published;
+  }
+
+  /// Poll until \p stop is set and no more input is available, yielding while idle.
+  void run(const std::atomic<bool>& stop) {
+    while (true) {
+      if (poll() > 0) continue;
+      if (stop.load(std::memory_order_acquire) && !pending_ && input_.sizeApprox() == 0) return;
+      std::this_thread::yield();
+    }
+  }
+
+  [[nodiscard]] const StageStats& stats() const {
+    return stats_;
+  }
+
+ private:
+  /// \return false if the frame was rejected by a filter and is not published
+  bool parseSlice() {
+    frame_.sequence = slice_.sequence;
+    frame_.status = parser_.tryParse(slice_.data, slice_.size, frame_.result);
+    if (frame_.status == FrameStatus::Filtered) {
+      stats_.filtered.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+    if (frame_.status != FrameStatus::Ok) stats_.invalid.fetch_add(1, std::memory_order_relaxed);
+    return true;
+  }
+
+  const ByteParser& parser_;
+  In& input_;
+  Out& output_;
+  FrameSlice slice_;
+  ParsedFrame frame_;  // Parsed, waiting for room in the output queue if pending_
+  bool pending_ = false;
+  StageStats stats_;
+};
+
+}  // namespace easy_byte_parser
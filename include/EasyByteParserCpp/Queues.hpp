@@ -0,0 +1,183 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace easy_byte_parser {
+
+/// Size of a cache line, used to keep indices written by different threads apart.
+inline constexpr size_t kCacheLine = 64;
+
+/// Bounded lock-free single-producer / single-consumer queue.
+/// Values are swapped in and out of preallocated slots, so types owning memory (e.g. ParseResult)
+/// are recycled between producer and consumer instead of being reallocated per element.
+template <typename T>
+class SpscQueue {
+ public:
+  /// \param capacity Minimum number of elements, rounded up to a power of two
+  explicit SpscQueue(size_t capacity) {
+    if (capacity == 0) throw std::invalid_argument("[EasyByteParserCpp]: Queue capacity must be greater than 0");
+    size_t size = 1;
+    while (size < capacity) size <<= 1;
+    slots_.resize(size);
+    mask_ = size - 1;
+  }
+
+  /// Producer only. Swap \p value into the queue, receiving a previously popped element in exchange.
+  /// \return false (and \p value unchanged) if the queue is full
+  bool tryPush(T& value) {
+    const uint64_t tail = tail_.load(std::memory_order_relaxed);
+    if (tail - headCache_ > mask_) {
+      headCache_ = head_.load(std::memory_order_acquire);
+      if (tail - headCache_ > mask_) {
+        fullCount_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+      }
+    }
+    std::swap(slots_[tail & mask_], value);
+    tail_.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  /// Producer only. Move \p value into the queue.
+  bool tryPush(T&& value) {
+    T local = std::move(value);
+    return tryPush(local);
+  }
+
+  /// Consumer only. Swap the oldest element into \p out, handing the previous content of \p out to the producer.
+  /// \return false if the queue is empty
+  bool tryPop(T& out) {
+    const uint64_t head = head_.load(std::memory_order_relaxed);
+    if (head == tailCache_) {
+      tailCache_ = tail_.load(std::memory_order_acquire);
+      if (head == tailCache_) return false;
+    }
+    std::swap(slots_[head & mask_], out);
+    head_.store(head + 1, std::memory_order_release);
+    return true;
+  }
+
+  [[nodiscard]] size_t capacity() const {
+    return mask_ + 1;
+  }
+
+  /// Number of queued elements; exact only when neither side is active.
+  [[nodiscard]] size_t sizeApprox() const {
+    return static_cast<size_t>(tail_.load(std::memory_order_acquire) - head_.load(std::memory_order_acquire));
+  }
+
+  /// Number of tryPush() calls rejected because the queue was full (backpressure).
+  [[nodiscard]] uint64_t fullCount() const {
+    return fullCount_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  std::vector<T> slots_;
+  size_t mask_ = 0;
+  alignas(kCacheLine) std::atomic<uint64_t> head_{0};  // Next slot to pop, written by the consumer
+  uint64_t tailCache_ = 0;                            // Consumer's copy of tail_
+  alignas(kCacheLine) std::atomic<uint64_t> tail_{0};  // Next slot to push, written by the producer
+  uint64_t headCache_ = 0;                            // Producer's copy of head_
+  std::atomic<uint64_t> fullCount_{0};
+};
+
+/// Bounded lock-free multi-producer / multi-consumer queue (sequence number per slot).
+/// Like SpscQueue, values are swapped in and out of the slots.
+template <typename T>
+class MpmcQueue {
+ public:
+  /// \param capacity Minimum number of elements, rounded up to a power of two
+  explicit MpmcQueue(size_t capacity) {
+    if (capacity == 0) throw std::invalid_argument("[EasyByteParserCpp]: Queue capacity must be greater than 0");
+    size_t size = 1;
+    while (size < capacity) size <<= 1;
+    slots_ = std::vector<Slot>(size);
+    for (size_t i = 0; i < size; ++i) slots_[i].sequence.store(i, std::memory_order_relaxed);
+    mask_ = size - 1;
+  }
+
+  /// Swap \p value into the queue. Safe to call from any number of threads.
+  /// \return false (and \p value unchanged) if the queue is full
+  bool tryPush(T& value) {
+    uint64_t pos = tail_.load(std::memory_order_relaxed);
+    while (true) {
+      Slot& slot = slots_[pos & mask_];
+      const uint64_t sequence = slot.sequence.load(std::memory_order_acquire);
+      const auto diff = static_cast<int64_t>(sequence - pos);
+      if (diff == 0) {
+        if (tail_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+          std::swap(slot.value, value);
+          slot.sequence.store(pos + 1, std::memory_order_release);
+          return true;
+        }
+      } else if (diff < 0) {
+        fullCount_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+      } else {
+        pos = tail_.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  bool tryPush(T&& value) {
+    T local = std::move(value);
+    return tryPush(local);
+  }
+
+  /// Swap the oldest element into \p out. Safe to call from any number of threads.
+  /// \return false if the queue is empty
+  bool tryPop(T& out) {
+    uint64_t pos = head_.load(std::memory_order_relaxed);
+    while (true) {
+      Slot& slot = slots_[pos & mask_];
+      const uint64_t sequence = slot.sequence.load(std::memory_order_acquire);
+      const auto diff = static_cast<int64_t>(sequence - (pos + 1));
+      if (diff == 0) {
+        if (head_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+          std::swap(slot.value, out);
+          slot.sequence.store(pos + mask_ + 1, std::memory_order_release);
+          return true;
+        }
+      } else if (diff < 0) {
+        return false;
+      } else {
+        pos = head_.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  [[nodiscard]] size_t capacity() const {
+    return mask_ + 1;
+  }
+
+  /// Number of queued elements; exact only when no thread is active.
+  [[nodiscard]] size_t sizeApprox() const {
+    const uint64_t tail = tail_.load(std::memory_order_acquire);
+    const uint64_t head = head_.load(std::memory_order_acquire);
+    return tail > head ? static_cast<size_t>(tail - head) : 0;
+  }
+
+  /// Number of tryPush() calls rejected because the queue was full (backpressure).
+  [[nodiscard]] uint64_t fullCount() const {
+    return fullCount_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  struct Slot {
+    std::atomic<uint64_t> sequence{0};
+    T value{};
+  };
+
+  std::vector<Slot> slots_;
+  size_t mask_ = 0;
+  alignas(kCacheLine) std::atomic<uint64_t> head_{0};
+  alignas(kCacheLine) std::atomic<uint64_t> tail_{0};
+  alignas(kCacheLine) std::atomic<uint64_t> fullCount_{0};
+};
+
+}  // namespace easy_byte_parser
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace easy_byte_parser {
+
+/// Fixed-capacity byte ring buffer whose readable bytes can be parsed in place.
+///
+/// On Linux the storage is mapped twice back to back (memfd_create + two mmap), so the
+/// readable bytes are always contiguous, also when they wrap around the end. Elsewhere, or
+/// when the mapping fails, the first \p slack bytes of the buffer are copied behind its end
+/// on every write, so that at least every range of up to \p slack bytes starting in the
+/// buffer is contiguous.
+///
+/// Not thread-safe: the producer and the consumer must be synchronized by the caller.
+class RingBuffer {
+ public:
+  /// \param capacity Minimum capacity in bytes, rounded up to a power of two (and to the page size when mirrored)
+  /// \param slack Bytes that must be contiguous after any read position, at most capacity
+  /// \param mirror Try the double mapping; false always uses the copied slack
+  RingBuffer(size_t capacity, size_t slack, bool mirror = true);
+  ~RingBuffer();
+
+  RingBuffer(const RingBuffer&) = delete;
+  RingBuffer& operator=(const RingBuffer&) = delete;
+
+  /// Copy up to \p size bytes into the buffer.
+  /// \return Number of bytes written, less than size if the buffer is full
+  size_t write(const char* data, size_t size);
+
+  /// Start of the free space, to receive data into directly (e.g. with recv()).
+  [[nodiscard]] char* writePtr() {
+    return data_ + (tail_ & mask_);
+  }
+
+  /// Free bytes that can be written at writePtr() in one go.
+  [[nodiscard]] size_t writableContiguous() const;
+
+  /// Publish \p size bytes written at writePtr(), at most writableContiguous().
+  void commit(size_t size);
+
+  /// Start of the readable bytes.
+  [[nodiscard]] const char* readPtr() const {
+    return data_ + (head_ & mask_);
+  }
+
+  /// Readable bytes that are contiguous at readPtr(), all of readable() when mirrored.
+  [[nodiscard]] size_t readableContiguous() const;
+
+  /// Release \p size bytes at readPtr(), at most readable().
+  void consume(size_t size);
+
+  [[nodiscard]] size_t readable() const {
+    return static_cast<size_t>(tail_ - head_);
+  }
+
+  [[nodiscard]] size_t writable() const {
+    return capacity() - readable();
+  }
+
+  [[nodiscard]] size_t capacity() const {
+    return mask_ + 1;
+  }
+
+  [[nodiscard]] size_t slack() const {
+    return slack_;
+  }
+
+  /// True if the storage is double-mapped.
+  [[nodiscard]] bool mirrored() const {
+    return mirrored_;
+  }
+
+ private:
+  bool mapMirrored(size_t capacity);
+
+  char* data_ = nullptr;
+  size_t mask_ = 0;
+  size_t slack_ = 0;
+  bool mirrored_ = false;
+  uint64_t head_ = 0;  // Total bytes consumed
+  uint64_t tail_ = 0;  // Total bytes committed
+};
+
+}  // namespace easy_byte_parser
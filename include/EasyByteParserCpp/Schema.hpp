@@ -0,0 +1,298 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <ratio>
+#include <tuple>
+#include <type_traits>
+
+#include "EasyByteParserCpp/ByteParser.hpp"
+
+namespace easy_byte_parser {
+
+// --- Compile-time schema ---
+// For layouts fixed at build time: offsets, widths, shifts, byte order and scaling are template
+// arguments, so Schema::decode() compiles to straight-line loads (with bswap / movbe where needed),
+// shifts and masks, with no field table or type dispatch at run time. The layout is validated
+// like ByteParser::validateConfig() (bounds, bit-level overlaps, CRC region), but by static_assert.
+//
+// Usage:
+//   EBP_FIELD_NAME(Rpm, "rpm");
+//   EBP_FIELD_NAME(Mode, "mode");
+//   using Engine = Schema<Frame<20, 2, 2>, Field<Rpm, uint16_t, 3>, Field<Mode, uint8_t, 11, BigEndian, Bits<1, 3>>>;
+//   Engine::Values v = Engine::decode(data);
+//   uint16_t rpm = v.get<Rpm>();
+
+/// Declare a field name tag for Field, e.g. EBP_FIELD_NAME(Rpm, "rpm").
+#define EBP_FIELD_NAME(Tag, text)             \
+  struct Tag {                                \
+    static constexpr const char* name = text; \
+  }
+
+/// Byte order of a Field.
+struct BigEndian {
+  static constexpr bool isBigEndian = true;
+};
+struct LittleEndian {
+  static constexpr bool isBigEndian = false;
+};
+
+/// Bit field of a Field: \p Count bits starting at bit \p Offset of the raw value (0 = LSB).
+template <size_t Offset, size_t Count>
+struct Bits {
+  static constexpr size_t offset = Offset;
+  static constexpr size_t count = Count;
+};
+using NoBits = Bits<0, 0>;
+
+/// Frame geometry of a Schema: the StartCode occupies the first \p StartCodeLength bytes and the
+/// checksum field the last \p CRCLength bytes of \p TotalLength.
+template <size_t TotalLength, size_t StartCodeLength = 0, size_t CRCLength = 0>
+struct Frame {
+  static_assert(TotalLength > 0, "TotalLength must be greater than 0");
+  static_assert(StartCodeLength <= TotalLength, "StartCode exceeds TotalLength");
+  static_assert(CRCLength <= TotalLength, "CRCLength exceeds TotalLength");
+
+  static constexpr size_t totalLength = TotalLength;
+  static constexpr size_t startCodeLength = StartCodeLength;
+  static constexpr size_t crcLength = CRCLength;
+};
+
+namespace schema_detail {
+
+template <typename T, typename = void>
+struct HasTypeName : std::false_type {};
+template <typename T>
+struct HasTypeName<T, std::void_t<decltype(TypeName<T>::value)>> : std::true_type {};
+
+template <size_t Size>
+struct UnsignedOfSize;
+template <>
+struct UnsignedOfSize<1> {
+  using type = uint8_t;
+};
+template <>
+struct UnsignedOfSize<2> {
+  using type = uint16_t;
+};
+template <>
+struct UnsignedOfSize<4> {
+  using type = uint32_t;
+};
+template <>
+struct UnsignedOfSize<8> {
+  using type = uint64_t;
+};
+
+/// Raw bits of a \p Size byte value. Assembled byte by byte, which compilers fold into one load
+/// plus a byte swap if the order differs from the host; no endianness check at run time.
+template <size_t Size, bool IsBigEndian>
+inline typename UnsignedOfSize<Size>::type loadBits(const char* data) noexcept {
+  using U = typename UnsignedOfSize<Size>::type;
+  const auto* bytes = reinterpret_cast<const unsigned char*>(data);
+  U value = 0;
+  for (size_t i = 0; i < Size; ++i) {
+    value |= static_cast<U>(static_cast<U>(bytes[i]) << (8 * (IsBigEndian ? Size - 1 - i : i)));
+  }
+  return value;
+}
+
+template <typename Ratio>
+constexpr double ratioValue() {
+  return static_cast<double>(Ratio::num) / static_cast<double>(Ratio::den);
+}
+
+template <typename T>
+struct TypeTag {
+  using type = T;
+};
+
+/// Field value type, following the runtime parser: bools stay bool, floats and scaled fields become
+/// double, bit fields become the unsigned wire type (as in ColumnarBatch), other integers keep their type.
+template <typename T, bool IsBitField, bool IsScaled>
+constexpr auto valueTypeOf() {
+  if constexpr (std::is_same_v<T, bool>)
+    return TypeTag<bool>{};
+  else if constexpr (std::is_floating_point_v<T> || IsScaled)
+    return TypeTag<double>{};
+  else if constexpr (IsBitField)
+    return TypeTag<std::make_unsigned_t<T>>{};
+  else
+    return TypeTag<T>{};
+}
+
+template <typename T, bool IsBitField, bool IsScaled>
+using ValueTypeOf = typename decltype(valueTypeOf<T, IsBitField, IsScaled>())::type;
+
+}  // namespace schema_detail
+
+/// One field of a Schema.
+/// \tparam Name Tag type with a `static constexpr const char* name`, see EBP_FIELD_NAME
+/// \tparam T Wire type, one of the types with a TypeName (uint8_t ... int64_t, float, double, bool)
+/// \tparam ByteOffset Offset of the field in the frame
+/// \tparam Order BigEndian or LittleEndian
+/// \tparam BitRange Bits<Offset, Count> for bit fields, NoBits otherwise
+/// \tparam Scale, Bias std::ratio applied as value * Scale + Bias (ignored for bools, like ByteParser)
+template <typename Name, typename T, size_t ByteOffset, typename Order = BigEndian, typename BitRange = NoBits,
+          typename Scale = std::ratio<1>, typename Bias = std::ratio<0>>
+struct Field {
+  static_assert(schema_detail::HasTypeName<T>::value, "Invalid Type: field type needs a TypeName");
+  static_assert(BitRange::offset + BitRange::count <= sizeof(T) * 8, "Bit logic exceeds type width");
+  static_assert(BitRange::count == 0 || !std::is_floating_point_v<T>, "Bit fields require an integer or bool type");
+  static_assert(!std::is_same_v<T, bool> || BitRange::count <= 1, "Bool bit fields are one bit wide");
+
+  using NameTag = Name;
+  using WireType = T;
+
+  static constexpr size_t byteOffset = ByteOffset;
+  static constexpr size_t size = sizeof(T);
+  static constexpr bool isBigEndian = Order::isBigEndian;
+  static constexpr bool isBitField = BitRange::count > 0;
+  static constexpr size_t bitOffset = BitRange::offset;
+  static constexpr size_t bitCount = BitRange::count;
+  static constexpr double scale = schema_detail::ratioValue<Scale>();
+  static constexpr double bias = schema_detail::ratioValue<Bias>();
+  static constexpr bool isScaled = !std::is_same_v<T, bool> && (scale != 1.0 || bias != 0.0);
+
+  using ValueType = schema_detail::ValueTypeOf<T, isBitField, isScaled>;
+
+  /// First and one past the last bit owned by the field, as checked for overlaps.
+  static constexpr size_t startBit = ByteOffset * 8 + BitRange::offset;
+  static constexpr size_t endBit = isBitField ? startBit + BitRange::count : ByteOffset * 8 + sizeof(T) * 8;
+
+  static ValueType decode(const char* frame) noexcept {
+    using U = typename schema_detail::UnsignedOfSize<sizeof(T)>::type;
+    U raw = schema_detail::loadBits<sizeof(T), isBigEndian>(frame + ByteOffset);
+    if constexpr (std::is_same_v<T, bool>) {
+      return isBitField ? ((raw >> BitRange::offset) & 1) != 0 : raw != 0;
+    } else if constexpr (std::is_floating_point_v<T>) {
+      T value;
+      std::memcpy(&value, &raw, sizeof(T));
+      return isScaled ? static_cast<double>(value) * scale + bias : static_cast<double>(value);
+    } else if constexpr (isBitField) {
+      constexpr U mask = static_cast<U>(BitRange::count >= 64 ? ~uint64_t{0} : (uint64_t{1} << BitRange::count) - 1);
+      auto bits = static_cast<U>((raw >> BitRange::offset) & mask);
+      if constexpr (isScaled) return static_cast<double>(bits) * scale + bias;
+      return bits;
+    } else {
+      auto value = static_cast<T>(raw);
+      if constexpr (isScaled) return static_cast<double>(value) * scale + bias;
+      return value;
+    }
+  }
+
+  /// Equivalent runtime definition, for ByteParser::addField().
+  static FieldDefinition definition() {
+    FieldDefinition fd;
+    fd.name = Name::name;
+    fd.byteOffset = ByteOffset;
+    fd.bitOffset = BitRange::offset;
+    fd.bitCount = BitRange::count;
+    fd.type = TypeName<T>::value;
+    fd.isBigEndian = isBigEndian;
+    fd.scale = scale;
+    fd.bias = bias;
+    return fd;
+  }
+};
+
+/// Decoded values of a Schema, a plain aggregate with one member per field.
+template <typename... Fields>
+struct SchemaValues {
+  std::tuple<typename Fields::ValueType...> values;
+
+  /// Value of the field with the given ordinal.
+  template <size_t I>
+  [[nodiscard]] const auto& get() const noexcept {
+    return std::get<I>(values);
+  }
+
+  /// Value of the field with the given name tag.
+  template <typename Name>
+  [[nodiscard]] const auto& get() const noexcept {
+    return std::get<indexOf<Name>()>(values);
+  }
+
+  /// Ordinal of the field with the given name tag.
+  template <typename Name>
+  static constexpr size_t indexOf() {
+    constexpr bool matches[] = {std::is_same_v<Name, typename Fields::NameTag>...};
+    for (size_t i = 0; i < sizeof...(Fields); ++i)
+      if (matches[i]) return i;
+    return sizeof...(Fields);
+  }
+};
+
+/// Layout known at compile time: \p FrameSpec (a Frame) plus the fields, in order.
+/// decode() only extracts values; frame checks (StartCode values, CRC, filters) stay with a
+/// ByteParser configured through configure(), e.g. parser.check() before decode().
+template <typename FrameSpec, typename... Fields>
+class Schema {
+  static constexpr size_t totalBits = FrameSpec::totalLength * 8;
+  static constexpr size_t crcStartBit = (FrameSpec::totalLength - FrameSpec::crcLength) * 8;
+  static constexpr size_t startBits[] = {Fields::startBit..., 0};
+  static constexpr size_t endBits[] = {Fields::endBit..., 0};
+  static constexpr bool hasDuplicateName() {
+    using Check = SchemaValues<Fields...>;
+    constexpr size_t firsts[] = {Check::template indexOf<typename Fields::NameTag>()..., 0};
+    for (size_t i = 0; i < sizeof...(Fields); ++i)
+      if (firsts[i] != i) return true;
+    return false;
+  }
+  static constexpr bool fieldsInBounds() {
+    for (size_t i = 0; i < sizeof...(Fields); ++i)
+      if (endBits[i] > totalBits) return false;
+    return true;
+  }
+  static constexpr bool fieldsOverlap() {
+    for (size_t i = 0; i < sizeof...(Fields); ++i)
+      for (size_t j = i + 1; j < sizeof...(Fields); ++j)
+        if (startBits[i] < endBits[j] && startBits[j] < endBits[i]) return true;
+    return false;
+  }
+  static constexpr bool fieldsOverlapCrc() {
+    for (size_t i = 0; i < sizeof...(Fields); ++i)
+      if (FrameSpec::crcLength > 0 && endBits[i] > crcStartBit) return true;
+    return false;
+  }
+
+  static_assert(!hasDuplicateName(), "Field names must be unique");
+  static_assert(fieldsInBounds(), "Field exceeds TotalLength");
+  static_assert(!fieldsOverlap(), "Overlap detected between fields");
+  static_assert(!fieldsOverlapCrc(), "Field overlaps with CRC");
+
+ public:
+  using Values = SchemaValues<Fields...>;
+
+  static constexpr size_t totalLength = FrameSpec::totalLength;
+  static constexpr size_t fieldCount = sizeof...(Fields);
+
+  /// Decode all fields of a frame of at least totalLength bytes.
+  static void decode(const char* frame, Values& out) noexcept {
+    out.values = std::make_tuple(Fields::decode(frame)...);
+  }
+
+  static Values decode(const char* frame) noexcept {
+    Values out;
+    decode(frame, out);
+    return out;
+  }
+
+  /// Decode a single field by name tag.
+  template <typename Name>
+  static auto decodeField(const char* frame) noexcept {
+    using F = std::tuple_element_t<Values::template indexOf<Name>(), std::tuple<Fields...>>;
+    return F::decode(frame);
+  }
+
+  /// Add the fields and TotalLength to a runtime parser, e.g. to check frames, render the
+  /// configuration checklist or compare results. StartCode and CRC values are set by the caller.
+  static ByteParser& configure(ByteParser& parser) {
+    parser.setTotalLength(totalLength);
+    (parser.addField(Fields::definition()), ...);
+    return parser;
+  }
+};
+
+}  // namespace easy_byte_parser
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+#include "EasyByteParserCpp/ByteParser.hpp"
+#include "EasyByteParserCpp/RingBuffer.hpp"
+
+namespace easy_byte_parser {
+
+/// Counters of a StreamFramer since construction or the last reset().
+struct StreamStats {
+  size_t frames = 0;          // Frames passed to the callback or batch
+  size_t crcErrors = 0;       // Candidates with a matching StartCode but a failed CRC check
+  size_t filtered = 0;        // Valid frames rejected by a filter predicate
+  size_t discardedBytes = 0;  // Bytes skipped while searching for a StartCode
+};
+
+/// Cuts frames of getTotalLength() bytes out of an unframed byte stream (serial, TCP, ...).
+/// Chunks of any size are fed in; frames are located by the StartCode, checked and decoded.
+/// After a failed check the search resumes one byte after the rejected StartCode.
+/// Frames lying completely inside a chunk are decoded in place; only the bytes of a frame
+/// split across chunks are buffered, at most TotalLength of them. Fed from a RingBuffer,
+/// no bytes are buffered by the framer at all.
+/// The parser must outlive the framer and should not be reconfigured while bytes are pending.
+class StreamFramer {
+ public:
+  using FrameCallback = std::function<void(const ParseResult&)>;
+
+  explicit StreamFramer(ByteParser& parser) : parser_(parser) {}
+
+  /// Consume a chunk, calling \p onFrame for each complete valid frame.
+  /// The ParseResult passed to the callback is reused for the next frame.
+  /// \param data Pointer to the chunk
+  /// \param size Size of the chunk
+  /// \param onFrame Callback invoked per frame
+  void feed(const char* data, size_t size, const FrameCallback& onFrame);
+
+  /// Consume a chunk, decoding all frames it completes into \p batch.
+  /// \param data Pointer to the chunk
+  /// \param size Size of the chunk
+  /// \param batch Output, one row per frame (all with FrameStatus::Ok), reused across calls
+  void feed(const char* data, size_t size, BatchResult& batch);
+
+  /// Consume the readable bytes of \p ring, calling \p onFrame for each complete valid frame.
+  /// Frames are decoded directly in the ring; a trailing partial frame is left in it
+  /// (not consumed) until the rest has been written.
+  /// Throws if the ring is not mirrored and its slack is shorter than TotalLength.
+  void feed(RingBuffer& ring, const FrameCallback& onFrame);
+
+  /// Consume the readable bytes of \p ring, decoding all complete frames into \p batch.
+  void feed(RingBuffer& ring, BatchResult& batch);
+
+  /// Drop buffered bytes and reset the statistics.
+  void reset();
+
+  /// Number of bytes buffered from previous chunks, the start of a frame still incomplete.
+  [[nodiscard]] size_t pending() const {
+    return carry_.size();
+  }
+
+  [[nodiscard]] const StreamStats& stats() const {
+    return stats_;
+  }
+
+ private:
+  /// Locate frames in a chunk and pass a pointer to each valid one to \p emit.
+  /// Pointers stay valid until the next call.
+  template <typename Emit>
+  void scan(const char* data, size_t size, Emit&& emit);
+
+  /// Scan a chunk with nothing carried over.
+  /// \return Start of a trailing partial frame, size if there is none
+  template <typename Emit>
+  size_t scanChunk(const char* data, size_t size, Emit&& emit);
+
+  /// Scan the readable bytes of a ring, leaving a trailing partial frame in it.
+  template <typename Emit>
+  void scanRing(RingBuffer& ring, Emit&& emit);
+
+  /// Decode a frame and pass it to the callback.
+  void deliver(const char* frame, const FrameCallback& onFrame);
+
+  /// Gather frame pointers for a batch, copying frames completed from carry_.
+  void beginCollect();
+  void collect(const char* frame);
+  void endCollect(BatchResult& batch);
+
+  /// StartCode, filter and CRC check, counting CRC failures and filtered frames.
+  /// Filtered is only returned for frames that also pass the CRC check.
+  FrameStatus classify(const char* frame);
+
+  ByteParser& parser_;
+  std::vector<char> carry_;     // Beginning of a frame split across chunks
+  std::vector<char> complete_;  // Last frame completed from carry_
+  std::vector<const char*> frames_;
+  std::vector<char> spill_;      // Copies of frames completed from carry_ during a batch feed
+  std::vector<size_t> spilled_;  // Indexes in frames_ of the copies in spill_
+  ParseResult result_;
+  StreamStats stats_;
+};
+
+}  // namespace easy_byte_parser
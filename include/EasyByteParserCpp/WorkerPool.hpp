@@ -0,0 +1,57 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace easy_byte_parser {
+
+/// Fixed set of worker threads executing numbered tasks, used by the parallel parse modes.
+/// Tasks are claimed one at a time from a shared counter, so threads that finish early keep
+/// taking the remaining tasks and uneven tasks balance out.
+class WorkerPool {
+ public:
+  /// \param threads Threads taking part in run(), including the calling thread; 0 for one per hardware thread
+  explicit WorkerPool(size_t threads = 0);
+  ~WorkerPool();
+
+  WorkerPool(const WorkerPool&) = delete;
+  WorkerPool& operator=(const WorkerPool&) = delete;
+
+  /// Threads taking part in run(), including the calling thread.
+  [[nodiscard]] size_t threadCount() const {
+    return workers_.size() + 1;
+  }
+
+  /// Execute task(0) ... task(count - 1) on the pool and the calling thread, returning when all are done.
+  /// The first exception thrown by a task is rethrown here; the remaining tasks still run.
+  /// Calls from several threads are serialized.
+  void run(size_t count, const std::function<void(size_t)>& task);
+
+ private:
+  void workerLoop();
+
+  /// Execute tasks until none are left.
+  void drain();
+
+  std::vector<std::thread> workers_;
+  std::mutex runMutex_;  // Serializes run()
+  std::mutex mutex_;
+  std::condition_variable wake_;
+  std::condition_variable done_;
+  const std::function<void(size_t)>* task_ = nullptr;
+  size_t count_ = 0;
+  std::atomic<size_t> next_{0};
+  size_t busy_ = 0;          // Workers still draining the current run
+  uint64_t generation_ = 0;  // Incremented per run()
+  bool stop_ = false;
+  std::exception_ptr error_;
+};
+
+}  // namespace easy_byte_parser
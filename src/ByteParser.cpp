@@ -1,15 +1,20 @@
 #include "EasyByteParserCpp/ByteParser.hpp"
 
+#include "EasyByteParserCpp/WorkerPool.hpp"
+#include "Jit.hpp"
+#include "SimdKernels.hpp"
 #include "Utils.hpp"
 
 #define MINI_CASE_SENSITIVE
 #include <algorithm>
 #include <cmath>
+#include <cstring>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
 #include <set>
 #include <sstream>
+#include <utility>
 
 #include "3rdparty/mini/ini.h"
 #include "3rdparty/nlohmann/json.hpp"
@@ -30,8 +35,41 @@ std::string ParsedValue::toString() const {
       value_);
 }
 
+const ParsedValue& ParseResult::at(const std::string& name) const {
+  if (layout_) {
+    auto it = layout_->index.find(name);
+    if (it != layout_->index.end()) return values_[it->second];
+  }
+  throw std::out_of_range("[EasyByteParserCpp]: No such field: " + name);
+}
+
+const ParsedValue& BatchResult::at(size_t frame, const std::string& name) const {
+  if (layout_) {
+    auto it = layout_->index.find(name);
+    if (it != layout_->index.end()) return value(frame, it->second);
+  }
+  throw std::out_of_range("[EasyByteParserCpp]: No such field: " + name);
+}
+
+const Column& ColumnarBatch::column(const std::string& name) const {
+  if (layout_) {
+    auto it = layout_->index.find(name);
+    if (it != layout_->index.end()) return columns_[it->second];
+  }
+  throw std::out_of_range("[EasyByteParserCpp]: No such field: " + name);
+}
+
+std::map<std::string, ParsedValue> ParseResult::toMap() const {
+  std::map<std::string, ParsedValue> result;
+  for (size_t i = 0; i < values_.size(); ++i) {
+    result[layout_->names[i]] = values_[i];
+  }
+  return result;
+}
+
 static bool isValidType(const std::string& t) {
-  static const std::set<std::string> valid = {"uint8", "int8", "uint16", "int16", "uint32", "int32", "float", "bool"};
+  static const std::set<std::string> valid = {"uint8", "int8",  "uint16", "int16",  "uint32", "int32",
+                                              "uint64", "int64", "float", "double", "bool"};
   return valid.find(t) != valid.end();
 }
 
@@ -39,25 +77,505 @@ static size_t getTypeSize(const std::string& t) {
   if (t == "uint8" || t == "int8" || t == "bool") return 1;
   if (t == "uint16" || t == "int16") return 2;
   if (t == "uint32" || t == "int32" || t == "float") return 4;
+  if (t == "uint64" || t == "int64" || t == "double") return 8;
   return 0;
 }
 
+static FieldType toFieldType(const std::string& t) {
+  if (t == "uint8") return FieldType::UInt8;
+  if (t == "int8") return FieldType::Int8;
+  if (t == "uint16") return FieldType::UInt16;
+  if (t == "int16") return FieldType::Int16;
+  if (t == "uint32") return FieldType::UInt32;
+  if (t == "int32") return FieldType::Int32;
+  if (t == "uint64") return FieldType::UInt64;
+  if (t == "int64") return FieldType::Int64;
+  if (t == "float") return FieldType::Float;
+  if (t == "double") return FieldType::Double;
+  if (t == "bool") return FieldType::Bool;
+  throw std::runtime_error("[EasyByteParserCpp]: Invalid Type: " + t);
+}
+
+// --- Compiled Layout ---
+
+template <typename T>
+static ParsedValue decodeInteger(const FieldOp& op, const char* ptr) {
+  T raw = utils::readSwapped<T>(ptr, op.byteSwap);
+  if (op.mask != 0) {
+    // Result of bitfield extraction is treated as unsigned
+    uint64_t bits = (static_cast<uint64_t>(raw) >> op.shift) & op.mask;
+    if (op.needsScaling) return ParsedValue(static_cast<double>(bits) * op.scale + op.bias);
+    return ParsedValue(bits);
+  }
+  if (op.needsScaling) return ParsedValue(static_cast<double>(raw) * op.scale + op.bias);
+  if constexpr (std::is_signed_v<T>)
+    return ParsedValue(static_cast<int64_t>(raw));
+  else
+    return ParsedValue(static_cast<uint64_t>(raw));
+}
+
+static ParsedValue decodeField(const FieldOp& op, const char* data) {
+  const char* ptr = data + op.byteOffset;
+  switch (op.type) {
+    case FieldType::UInt8:
+      return decodeInteger<uint8_t>(op, ptr);
+    case FieldType::Int8:
+      return decodeInteger<int8_t>(op, ptr);
+    case FieldType::UInt16:
+      return decodeInteger<uint16_t>(op, ptr);
+    case FieldType::Int16:
+      return decodeInteger<int16_t>(op, ptr);
+    case FieldType::UInt32:
+      return decodeInteger<uint32_t>(op, ptr);
+    case FieldType::Int32:
+      return decodeInteger<int32_t>(op, ptr);
+    case FieldType::UInt64:
+      return decodeInteger<uint64_t>(op, ptr);
+    case FieldType::Int64:
+      return decodeInteger<int64_t>(op, ptr);
+    case FieldType::Float: {
+      auto raw = utils::readSwapped<float>(ptr, op.byteSwap);
+      if (op.needsScaling) return ParsedValue(static_cast<double>(raw) * op.scale + op.bias);
+      return ParsedValue(static_cast<double>(raw));
+    }
+    case FieldType::Double: {
+      auto raw = utils::readSwapped<double>(ptr, op.byteSwap);
+      return ParsedValue(op.needsScaling ? raw * op.scale + op.bias : raw);
+    }
+    case FieldType::Bool: {
+      auto raw = static_cast<uint8_t>(*ptr);
+      if (op.mask != 0) raw = (raw >> op.shift) & 1;
+      return ParsedValue(static_cast<bool>(raw));
+    }
+  }
+  return ParsedValue();
+}
+
+ParsedValue FrameView::operator[](size_t index) const {
+  return decodeField(layout_->ops[index], data_);
+}
+
+ParsedValue FrameView::at(const std::string& name) const {
+  if (layout_) {
+    auto it = layout_->index.find(name);
+    if (it != layout_->index.end()) return (*this)[it->second];
+  }
+  throw std::out_of_range("[EasyByteParserCpp]: No such field: " + name);
+}
+
+template <typename T>
+static double integerNumber(const FieldOp& op, const char* ptr) {
+  T raw = utils::readSwapped<T>(ptr, op.byteSwap);
+  double v = op.mask != 0 ? static_cast<double>((static_cast<uint64_t>(raw) >> op.shift) & op.mask)
+                          : static_cast<double>(raw);
+  return op.needsScaling ? v * op.scale + op.bias : v;
+}
+
+// Value of a field as double, as compared by filters
+static double numericValue(const FieldOp& op, const char* data) {
+  const char* ptr = data + op.byteOffset;
+  switch (op.type) {
+    case FieldType::UInt8:
+      return integerNumber<uint8_t>(op, ptr);
+    case FieldType::Int8:
+      return integerNumber<int8_t>(op, ptr);
+    case FieldType::UInt16:
+      return integerNumber<uint16_t>(op, ptr);
+    case FieldType::Int16:
+      return integerNumber<int16_t>(op, ptr);
+    case FieldType::UInt32:
+      return integerNumber<uint32_t>(op, ptr);
+    case FieldType::Int32:
+      return integerNumber<int32_t>(op, ptr);
+    case FieldType::UInt64:
+      return integerNumber<uint64_t>(op, ptr);
+    case FieldType::Int64:
+      return integerNumber<int64_t>(op, ptr);
+    case FieldType::Float: {
+      auto raw = static_cast<double>(utils::readSwapped<float>(ptr, op.byteSwap));
+      return op.needsScaling ? raw * op.scale + op.bias : raw;
+    }
+    case FieldType::Double: {
+      auto raw = utils::readSwapped<double>(ptr, op.byteSwap);
+      return op.needsScaling ? raw * op.scale + op.bias : raw;
+    }
+    case FieldType::Bool: {
+      auto raw = static_cast<uint8_t>(*ptr);
+      return op.mask != 0 ? (raw >> op.shift) & 1 : raw != 0;
+    }
+  }
+  return 0.0;
+}
+
+// Significant bits of the raw value of an op: the bit count of bit fields, the wire width otherwise
+static unsigned rawBitsOf(const FieldOp& op) {
+  if (op.mask != 0) {
+    unsigned bits = 0;
+    for (uint64_t m = op.mask; m != 0; m >>= 1) ++bits;
+    return bits;
+  }
+  switch (op.type) {
+    case FieldType::UInt8:
+    case FieldType::Int8:
+    case FieldType::Bool:
+      return 8;
+    case FieldType::UInt16:
+    case FieldType::Int16:
+      return 16;
+    case FieldType::UInt32:
+    case FieldType::Int32:
+    case FieldType::Float:
+      return 32;
+    default:
+      return 64;
+  }
+}
+
+static ScaleKind classifyScale(double scale, double bias, unsigned rawBits) {
+  if (scale == 1.0 && bias == 0.0) return ScaleKind::Identity;
+  // For raws of up to 32 bits, products below 2^52 and sums below 2^53 are exact in int64_t and double.
+  // Wider raws could overflow int64_t and are left to the general affine.
+  if (rawBits > 32) return ScaleKind::Affine;
+  if (scale == std::trunc(scale) && bias == std::trunc(bias) && std::fabs(scale) <= 0x1p20 &&
+      std::fabs(bias) <= 0x1p51) {
+    return ScaleKind::Integer;
+  }
+  int exponent;
+  if (std::fabs(std::frexp(scale, &exponent)) == 0.5) return ScaleKind::PowerOfTwo;
+  return ScaleKind::Affine;
+}
+
+static Affine affineOf(const FieldOp& op) {
+  Affine affine;
+  affine.kind = op.scaleKind;
+  affine.scale = op.scale;
+  affine.bias = op.bias;
+  affine.rawBits = rawBitsOf(op);
+  if (op.scaleKind == ScaleKind::Identity) {
+    affine.scale = 1.0;
+    affine.bias = 0.0;
+  } else if (op.scaleKind == ScaleKind::Integer) {
+    affine.integerScale = static_cast<int64_t>(op.scale);
+    affine.integerBias = static_cast<int64_t>(op.bias);
+  } else if (op.scaleKind == ScaleKind::PowerOfTwo) {
+    std::frexp(op.scale, &affine.exponent);
+    affine.exponent -= 1;
+  }
+  return affine;
+}
+
+FixedPoint Affine::fixedPoint(unsigned fractionalBits) const {
+  if (rawBits > 32) {
+    throw std::out_of_range("[EasyByteParserCpp]: Q-format conversion supports raw values of up to 32 bits, not " +
+                            std::to_string(rawBits));
+  }
+  // Q-format of value = raw * scale + bias is raw * scaleQ + biasQ, exact power-of-two scaling
+  const double scaleQ = std::ldexp(scale, static_cast<int>(fractionalBits));
+  const double biasQ = std::ldexp(bias, static_cast<int>(fractionalBits));
+  auto integral = [](double v) { return v == std::trunc(v); };
+
+  // Multiplier below 2^30 and offset below 2^62 keep raw * multiplier + offset in int64_t for 32-bit raws
+  int shift = 0;
+  if (!integral(scaleQ) || !integral(biasQ)) {
+    int scaleExponent = 0;
+    std::frexp(scaleQ, &scaleExponent);
+    shift = 30 - scaleExponent;
+    if (biasQ != 0.0) {
+      int biasExponent = 0;
+      std::frexp(biasQ, &biasExponent);
+      shift = std::min(shift, 61 - biasExponent);
+    }
+    shift = std::min(shift, 62);
+  }
+  const double multiplier = std::ldexp(scaleQ, shift);
+  const double offset = std::ldexp(biasQ, shift);
+  if (shift < 0 || std::fabs(multiplier) >= 0x1p30 || std::fabs(offset) >= 0x1p62) {
+    throw std::out_of_range("[EasyByteParserCpp]: Scale and bias do not fit Q-format with " +
+                            std::to_string(fractionalBits) + " fraction bits");
+  }
+
+  FixedPoint fixed;
+  fixed.multiplier = std::llround(multiplier);
+  fixed.offset = std::llround(offset) + (shift > 0 ? int64_t{1} << (shift - 1) : 0);
+  fixed.shift = static_cast<unsigned>(shift);
+  fixed.fractionalBits = fractionalBits;
+  fixed.exact = integral(multiplier) && integral(offset);
+  return fixed;
+}
+
+static FieldOp compileField(const FieldDefinition& f, bool systemBigEndian, bool rawIntegers = false) {
+  FieldOp op;
+  op.type = toFieldType(f.type);
+  op.byteOffset = f.byteOffset;
+  op.byteSwap = getTypeSize(f.type) > 1 && f.isBigEndian != systemBigEndian;
+  const bool isFloat = op.type == FieldType::Float || op.type == FieldType::Double;
+  if (f.bitCount > 0 && !isFloat) {
+    op.shift = static_cast<uint8_t>(f.bitOffset);
+    op.mask = op.type == FieldType::Bool ? 1 : f.bitCount >= 64 ? ~uint64_t{0} : ((1ULL << f.bitCount) - 1);
+  }
+  // Bools are never scaled
+  op.scale = f.scale;
+  op.bias = f.bias;
+  op.scaleKind = op.type == FieldType::Bool ? ScaleKind::Identity : classifyScale(f.scale, f.bias, rawBitsOf(op));
+  op.needsScaling = op.scaleKind != ScaleKind::Identity && !(rawIntegers && !isFloat);
+  return op;
+}
+
+const FieldDefinition* ByteParser::findFieldDefinition(const std::string& name) const {
+  for (const auto* list : {&fields_, &filterFields_}) {
+    for (const auto& f : *list) {
+      if (f.name == name) return &f;
+    }
+  }
+  return nullptr;
+}
+
+const CompiledLayout& ByteParser::compile() {
+  if (!dirty_) return *layout_;
+  validateConfig();
+
+  const bool systemBigEndian = utils::isBigEndianSystem();
+  auto layout = std::make_shared<CompiledLayout>();
+  layout->ops.reserve(fields_.size());
+  layout->names.reserve(fields_.size());
+
+  for (const auto& f : fields_) {
+    layout->index[f.name] = layout->ops.size();
+    layout->ops.push_back(compileField(f, systemBigEndian, rawIntegers_));
+    layout->names.push_back(f.name);
+  }
+  for (const auto& filter : filters_) {
+    layout->filters.push_back({compileField(*findFieldDefinition(filter.field), systemBigEndian), filter.op,
+                               filter.value});
+  }
+  if (jit_) layout->jitCode = jit::compile(layout->ops, layout->flatDecode);
+  checksum_ = crcAlgo_.empty() ? nullptr : checksum::find(crcAlgo_);
+  layout_ = std::move(layout);
+  dirty_ = false;
+  return *layout_;
+}
+
+ByteParser ByteParser::select(const std::vector<std::string>& names) const {
+  ByteParser projection(*this);
+  projection.fields_.clear();
+  for (const auto& name : names) {
+    auto named = [&](const FieldDefinition& f) { return f.name == name; };
+    if (std::any_of(projection.fields_.begin(), projection.fields_.end(), named)) continue;  // Selected twice
+    auto it = std::find_if(fields_.begin(), fields_.end(), named);
+    if (it == fields_.end()) throw std::out_of_range("[EasyByteParserCpp]: No such field: " + name);
+    projection.fields_.push_back(*it);
+  }
+  // Filters keep reading their fields, which are not decoded unless selected
+  for (const auto& filter : filters_) {
+    auto named = [&](const FieldDefinition& f) { return f.name == filter.field; };
+    const FieldDefinition* f = findFieldDefinition(filter.field);
+    if (f && std::none_of(projection.fields_.begin(), projection.fields_.end(), named) &&
+        std::none_of(projection.filterFields_.begin(), projection.filterFields_.end(), named)) {
+      projection.filterFields_.push_back(*f);
+    }
+  }
+  projection.dirty_ = true;
+  projection.compile();
+  return projection;
+}
+
+// Position in ParsedValue::ValueType of the values produced by an op
+static size_t valueIndexOf(const FieldOp& op) {
+  if (op.type == FieldType::Bool) return ParsedValue::indexOf<bool>();
+  if (op.type == FieldType::Float || op.type == FieldType::Double || op.needsScaling) {
+    return ParsedValue::indexOf<double>();
+  }
+  if (op.mask != 0) return ParsedValue::indexOf<uint64_t>();
+  switch (op.type) {
+    case FieldType::Int8:
+    case FieldType::Int16:
+    case FieldType::Int32:
+    case FieldType::Int64:
+      return ParsedValue::indexOf<int64_t>();
+    default:
+      return ParsedValue::indexOf<uint64_t>();
+  }
+}
+
+// Zero of the value type produced by an op
+static ParsedValue zeroValueOf(const FieldOp& op) {
+  const size_t index = valueIndexOf(op);
+  if (index == ParsedValue::indexOf<bool>()) return ParsedValue(false);
+  if (index == ParsedValue::indexOf<double>()) return ParsedValue(0.0);
+  if (index == ParsedValue::indexOf<int64_t>()) return ParsedValue(int64_t{0});
+  return ParsedValue(uint64_t{0});
+}
+
+ParsedValue FlatResult::operator[](size_t index) const {
+  const uint64_t slot = slots_[index];
+  switch (valueIndexOf(layout_->ops[index])) {
+    case ParsedValue::indexOf<int64_t>():
+      return ParsedValue(static_cast<int64_t>(slot));
+    case ParsedValue::indexOf<double>(): {
+      double value;
+      std::memcpy(&value, &slot, sizeof(value));
+      return ParsedValue(value);
+    }
+    case ParsedValue::indexOf<bool>():
+      return ParsedValue(slot != 0);
+    default:
+      return ParsedValue(slot);
+  }
+}
+
+static uint64_t doubleBits(double value) {
+  uint64_t bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+  return bits;
+}
+
+template <typename T>
+static uint64_t flatInteger(const FieldOp& op, const char* ptr) {
+  T raw = utils::readSwapped<T>(ptr, op.byteSwap);
+  if (op.mask != 0) {
+    uint64_t bits = (static_cast<uint64_t>(raw) >> op.shift) & op.mask;
+    return op.needsScaling ? doubleBits(static_cast<double>(bits) * op.scale + op.bias) : bits;
+  }
+  if (op.needsScaling) return doubleBits(static_cast<double>(raw) * op.scale + op.bias);
+  if constexpr (std::is_signed_v<T>)
+    return static_cast<uint64_t>(static_cast<int64_t>(raw));
+  else
+    return static_cast<uint64_t>(raw);
+}
+
+// Interpreted counterpart of the JIT-compiled FlatDecodeFn
+static uint64_t flatField(const FieldOp& op, const char* data) {
+  const char* ptr = data + op.byteOffset;
+  switch (op.type) {
+    case FieldType::UInt8:
+      return flatInteger<uint8_t>(op, ptr);
+    case FieldType::Int8:
+      return flatInteger<int8_t>(op, ptr);
+    case FieldType::UInt16:
+      return flatInteger<uint16_t>(op, ptr);
+    case FieldType::Int16:
+      return flatInteger<int16_t>(op, ptr);
+    case FieldType::UInt32:
+      return flatInteger<uint32_t>(op, ptr);
+    case FieldType::Int32:
+      return flatInteger<int32_t>(op, ptr);
+    case FieldType::UInt64:
+      return flatInteger<uint64_t>(op, ptr);
+    case FieldType::Int64:
+      return flatInteger<int64_t>(op, ptr);
+    case FieldType::Float: {
+      auto raw = static_cast<double>(utils::readSwapped<float>(ptr, op.byteSwap));
+      return doubleBits(op.needsScaling ? raw * op.scale + op.bias : raw);
+    }
+    case FieldType::Double: {
+      auto raw = utils::readSwapped<double>(ptr, op.byteSwap);
+      return doubleBits(op.needsScaling ? raw * op.scale + op.bias : raw);
+    }
+    case FieldType::Bool: {
+      auto raw = static_cast<uint8_t>(*ptr);
+      return op.mask != 0 ? (raw >> op.shift) & 1 : raw != 0;
+    }
+  }
+  return 0;
+}
+
+size_t ByteParser::resolveField(const std::string& name, size_t valueIndex) const {
+  static const char* const valueNames[] = {"uint64", "int64", "double", "bool", "string"};
+  requireCompiled();
+  const CompiledLayout& layout = *layout_;
+  auto it = layout.index.find(name);
+  if (it == layout.index.end()) {
+    throw std::runtime_error("[EasyByteParserCpp]: No such field: " + name);
+  }
+  size_t actual = valueIndexOf(layout.ops[it->second]);
+  if (actual != valueIndex) {
+    throw std::runtime_error("[EasyByteParserCpp]: Field " + name + " is parsed as " + valueNames[actual] + ", not " +
+                             valueNames[valueIndex]);
+  }
+  return it->second;
+}
+
 // --- Programmatic API Implementation ---
 
+ByteParser& ByteParser::addFilter(const std::string& field, CompareOp op, double value) {
+  filters_.push_back({field, op, value});
+  dirty_ = true;
+  return *this;
+}
+
+ByteParser& ByteParser::addFilter(const std::string& field, const std::string& op, double value) {
+  static const std::pair<const char*, CompareOp> ops[] = {{"==", CompareOp::Eq}, {"!=", CompareOp::Ne},
+                                                          {"<", CompareOp::Lt},  {"<=", CompareOp::Le},
+                                                          {">", CompareOp::Gt},  {">=", CompareOp::Ge}};
+  for (const auto& [name, compare] : ops) {
+    if (op == name) return addFilter(field, compare, value);
+  }
+  throw std::runtime_error("[EasyByteParserCpp]: Invalid filter comparison: " + op);
+}
+
+ByteParser& ByteParser::setRawIntegers(bool enabled) {
+  rawIntegers_ = enabled;
+  dirty_ = true;
+  return *this;
+}
+
+Affine ByteParser::affine(const std::string& name) {
+  compile();
+  return std::as_const(*this).affine(name);
+}
+
+Affine ByteParser::affine(const std::string& name) const {
+  requireCompiled();
+  const CompiledLayout& layout = *layout_;
+  auto it = layout.index.find(name);
+  if (it == layout.index.end()) {
+    throw std::runtime_error("[EasyByteParserCpp]: No such field: " + name);
+  }
+  return affineOf(layout.ops[it->second]);
+}
+
+ByteParser& ByteParser::setJit(bool enabled) {
+  jit_ = enabled;
+  dirty_ = true;
+  return *this;
+}
+
+ByteParser& ByteParser::clearFilters() {
+  filters_.clear();
+  dirty_ = true;
+  return *this;
+}
+
 ByteParser& ByteParser::setTotalLength(size_t length) {
   totalLength_ = length;
+  dirty_ = true;
   return *this;
 }
 
 ByteParser& ByteParser::setStartCode(const std::vector<uint8_t>& code, size_t length) {
   startCode_ = code;
   startCodeLength_ = length;
+  dirty_ = true;
   return *this;
 }
 
 ByteParser& ByteParser::setCRC(const std::string& algo, size_t length) {
   crcAlgo_ = algo;
   crcLength_ = length;
+  dirty_ = true;
+  return *this;
+}
+
+ByteParser& ByteParser::setCRCEndian(bool isBigEndian) {
+  crcBigEndian_ = isBigEndian;
+  dirty_ = true;
+  return *this;
+}
+
+ByteParser& ByteParser::setCRCRange(size_t start, size_t end) {
+  crcStart_ = start;
+  crcEnd_ = end;
+  dirty_ = true;
   return *this;
 }
 
@@ -67,6 +585,7 @@ ByteParser& ByteParser::addField(const FieldDefinition& definition) {
     throw std::runtime_error("[EasyByteParserCpp]: Invalid type for field " + definition.name + ": " + definition.type);
   }
   fields_.push_back(definition);
+  dirty_ = true;
   return *this;
 }
 
@@ -76,7 +595,14 @@ void ByteParser::clear() {
   startCodeLength_ = 0;
   crcAlgo_.clear();
   crcLength_ = 0;
+  crcBigEndian_ = false;
+  crcStart_ = 0;
+  crcEnd_ = 0;
+  checksum_.reset();
   fields_.clear();
+  filters_.clear();
+  filterFields_.clear();
+  dirty_ = true;
 }
 
 void ByteParser::validateConfig() const {
@@ -89,12 +615,29 @@ void ByteParser::validateConfig() const {
     if (startCode_.size() > startCodeLength_) {
       throw std::runtime_error("[EasyByteParserCpp]: StartCode binary size exceeds StartCodeLength");
     }
+    if (startCode_.size() > totalLength_) {
+      throw std::runtime_error("[EasyByteParserCpp]: StartCode exceeds TotalLength");
+    }
   }
 
   // CRC Validation
   if (!crcAlgo_.empty()) {
-    if (crcAlgo_ == "CRC16" && crcLength_ != 2) {
-      throw std::runtime_error("[EasyByteParserCpp]: CRC16 algorithm requires CRCLength=2");
+    auto algorithm = checksum::find(crcAlgo_);
+    if (!algorithm) {
+      throw std::runtime_error("[EasyByteParserCpp]: Unsupported CRC Algorithm: " + crcAlgo_);
+    }
+    if (crcLength_ != algorithm->length) {
+      throw std::runtime_error("[EasyByteParserCpp]: " + crcAlgo_ + " algorithm requires CRCLength=" +
+                               std::to_string(algorithm->length));
+    }
+    if (crcLength_ > totalLength_) {
+      throw std::runtime_error("[EasyByteParserCpp]: CRCLength exceeds TotalLength");
+    }
+    if (getCRCEnd() > totalLength_ - crcLength_) {
+      throw std::runtime_error("[EasyByteParserCpp]: CRC range overlaps the CRC field");
+    }
+    if (crcStart_ > getCRCEnd()) {
+      throw std::runtime_error("[EasyByteParserCpp]: CRC range start exceeds its end");
     }
   }
 
@@ -113,6 +656,11 @@ void ByteParser::validateConfig() const {
     const auto& f = fields_[i];
     size_t sz = getTypeSize(f.type);
 
+    // loadConfig() reads the [Filter] section as filters, a field of that name could not be configured
+    if (f.name == "Filter") {
+      throw std::runtime_error("[EasyByteParserCpp]: Field name Filter is reserved for the filter section");
+    }
+
     // Bounds check (Byte level first for simplicity)
     if (f.byteOffset + sz > totalLength_) {
       throw std::runtime_error("[EasyByteParserCpp]: Field " + f.name + " exceeds TotalLength");
@@ -147,6 +695,26 @@ void ByteParser::validateConfig() const {
       bitOwner[b] = (int)i;
     }
   }
+
+  // Fields kept for the filters of a projection are not decoded, but still read from the frame
+  for (const auto& f : filterFields_) {
+    size_t sz = getTypeSize(f.type);
+    if (f.byteOffset + sz > totalLength_) {
+      throw std::runtime_error("[EasyByteParserCpp]: Field " + f.name + " exceeds TotalLength");
+    }
+    if (f.bitCount > 0 && f.bitOffset + f.bitCount > sz * 8) {
+      throw std::runtime_error("[EasyByteParserCpp]: Bit logic exceeds type width for field " + f.name);
+    }
+    if (!crcAlgo_.empty() && f.byteOffset + sz > totalLength_ - crcLength_) {
+      throw std::runtime_error("[EasyByteParserCpp]: Field " + f.name + " overlaps with CRC");
+    }
+  }
+
+  for (const auto& filter : filters_) {
+    if (!findFieldDefinition(filter.field)) {
+      throw std::runtime_error("[EasyByteParserCpp]: Filter on unknown field " + filter.field);
+    }
+  }
 }
 
 // --- Legacy / INI Loader ---
@@ -197,10 +765,21 @@ void ByteParser::loadConfig(const std::string& configPath) {
   if (header.has("CRCAlgo") && header.has("CRCLength")) {
     setCRC(header["CRCAlgo"], std::stoul(header["CRCLength"]));
   }
+  if (header.has("CRCEndian")) {
+    std::string endian = utils::toLower(header["CRCEndian"]);
+    if (endian != "big" && endian != "little") {
+      throw std::runtime_error("[EasyByteParserCpp]: Invalid Header.CRCEndian: " + header["CRCEndian"]);
+    }
+    setCRCEndian(endian == "big");
+  }
+  if (header.has("CRCStart") || header.has("CRCEnd")) {
+    setCRCRange(header.has("CRCStart") ? std::stoul(header["CRCStart"]) : 0,
+                header.has("CRCEnd") ? std::stoul(header["CRCEnd"]) : 0);
+  }
 
   // 2. Fields
   for (auto const& it : ini) {
-    if (it.first == "Header") continue;
+    if (it.first == "Header" || it.first == "Filter") continue;
 
     // Section name is Field Name
     auto& section = it.second;
@@ -232,117 +811,566 @@ void ByteParser::loadConfig(const std::string& configPath) {
     addField(fd);
   }
 
-  validateConfig();
+  // 3. Filters, one line per field with comma separated predicates: <field> = <op> <value>[, <op> <value>...],
+  //    e.g. bit.mode = > 1, != 3. A key can appear only once per section, so a field's predicates share its line.
+  if (ini.has("Filter")) {
+    for (auto const& [field, conditions] : ini["Filter"]) {
+      const std::vector<std::string> predicates = utils::split(conditions, ',');
+      if (predicates.empty()) {
+        throw std::runtime_error("[EasyByteParserCpp]: Invalid filter for " + field + ": " + conditions);
+      }
+      for (const auto& condition : predicates) {
+        size_t split = condition.find_first_not_of("<>=!");
+        if (split == 0 || split == std::string::npos) {
+          throw std::runtime_error("[EasyByteParserCpp]: Invalid filter for " + field + ": " + condition);
+        }
+        std::string op = condition.substr(0, split);
+        double value;
+        try {
+          value = std::stod(condition.substr(split));
+        } catch (...) {
+          throw std::runtime_error("[EasyByteParserCpp]: Invalid filter for " + field + ": " + condition);
+        }
+        addFilter(field, op, value);
+      }
+    }
+  }
+
+  compile();
 }
 
 std::map<std::string, ParsedValue> ByteParser::parse(const std::vector<char>& buffer) {
+  compile();
+  return std::as_const(*this).parse(buffer);
+}
+
+std::map<std::string, ParsedValue> ByteParser::parse(const char* data, size_t size) {
+  compile();
+  return std::as_const(*this).parse(data, size);
+}
+
+void ByteParser::parse(const char* data, size_t size, ParseResult& result) {
+  // Ensure valid configuration, re-validated only after a configuration change
+  compile();
+  std::as_const(*this).parse(data, size, result);
+}
+
+void ByteParser::parse(const char* data, size_t size, FlatResult& result) {
+  compile();
+  std::as_const(*this).parse(data, size, result);
+}
+
+void ByteParser::requireCompiled() const {
+  if (!isCompiled()) {
+    throw std::runtime_error("[EasyByteParserCpp]: Configuration changed since compile(), const parse is not possible");
+  }
+}
+
+std::map<std::string, ParsedValue> ByteParser::parse(const std::vector<char>& buffer) const {
   if (buffer.empty()) throw std::runtime_error("[EasyByteParserCpp]: Empty buffer");
   return parse(buffer.data(), buffer.size());
 }
 
-std::map<std::string, ParsedValue> ByteParser::parse(const char* data, size_t size) {
-  // Ensure valid configuration
-  validateConfig();
+std::map<std::string, ParsedValue> ByteParser::parse(const char* data, size_t size) const {
+  ParseResult result;
+  parse(data, size, result);
+  return result.toMap();
+}
+
+void ByteParser::parse(const char* data, size_t size, ParseResult& result) const {
+  requireCompiled();
+  verifyFrame(data, size);
+  decodeFrame(data, result);
+}
+
+FrameStatus ByteParser::tryParse(const char* data, size_t size, ParseResult& result) const {
+  requireCompiled();
+  FrameStatus status = checkFrame(data, size);
+  if (status == FrameStatus::Ok) decodeFrame(data, result);
+  return status;
+}
+
+void ByteParser::parse(const char* data, size_t size, FlatResult& result) const {
+  requireCompiled();
+  verifyFrame(data, size);
+  decodeFrame(data, result);
+}
+
+FrameStatus ByteParser::tryParse(const char* data, size_t size, FlatResult& result) const {
+  requireCompiled();
+  FrameStatus status = checkFrame(data, size);
+  if (status == FrameStatus::Ok) decodeFrame(data, result);
+  return status;
+}
 
-  if (size < totalLength_) {
-    throw std::runtime_error("[EasyByteParserCpp]: Buffer size (" + std::to_string(size) +
+void ByteParser::decodeFrame(const char* data, FlatResult& result) const {
+  const CompiledLayout& layout = *layout_;
+  if (result.layout_ != layout_) {
+    result.layout_ = layout_;
+    result.slots_.assign(layout.ops.size(), 0);
+  }
+  if (layout.flatDecode) {
+    layout.flatDecode(data, result.slots_.data());
+    return;
+  }
+  for (size_t i = 0; i < layout.ops.size(); ++i) {
+    result.slots_[i] = flatField(layout.ops[i], data);
+  }
+}
+
+FrameView ByteParser::view(const char* data, size_t size) {
+  compile();
+  return std::as_const(*this).view(data, size);
+}
+
+FrameView ByteParser::view(const char* data, size_t size) const {
+  requireCompiled();
+  verifyFrame(data, size);
+  FrameView frame;
+  frame.data_ = data;
+  frame.layout_ = layout_;
+  return frame;
+}
+
+FrameStatus ByteParser::check(const char* data, size_t size) const {
+  requireCompiled();
+  return checkFrame(data, size);
+}
+
+FrameStatus ByteParser::tryView(const char* data, size_t size, FrameView& view) const {
+  requireCompiled();
+  FrameStatus status = checkFrame(data, size);
+  if (status == FrameStatus::Ok) {
+    view.data_ = data;
+    if (view.layout_ != layout_) view.layout_ = layout_;
+  }
+  return status;
+}
+
+void ByteParser::decodeFrame(const char* data, ParseResult& result) const {
+  const CompiledLayout& layout = *layout_;
+  if (result.layout_ != layout_) {
+    result.layout_ = layout_;
+    result.values_.assign(layout.ops.size(), ParsedValue());
+  }
+  for (size_t i = 0; i < layout.ops.size(); ++i) {
+    result.values_[i] = decodeField(layout.ops[i], data);
+  }
+}
+
+void ByteParser::checkBatch(size_t stride) const {
+  if (stride < totalLength_) {
+    throw std::runtime_error("[EasyByteParserCpp]: Batch stride (" + std::to_string(stride) +
                              ") < Configured TotalLength (" + std::to_string(totalLength_) + ")");
   }
+}
 
-  // StartCode Check
-  if (!startCode_.empty()) {
-    if (size < startCode_.size()) {
-      throw std::runtime_error("[EasyByteParserCpp]: Buffer too small for StartCode");
-    }
-    for (size_t i = 0; i < startCode_.size(); ++i) {
-      if (static_cast<uint8_t>(data[i]) != startCode_[i]) {
-        std::stringstream ss;
-        ss << "[EasyByteParserCpp]: Invalid Start Code at byte " << i << ". Expected 0x" << std::hex << std::setw(2)
-           << std::setfill('0') << (int)startCode_[i] << " but got 0x" << (int)(uint8_t)data[i];
-        throw std::runtime_error(ss.str());
-      }
+// Indexes of the Ok frames of a batch
+static void buildSelection(const std::vector<FrameStatus>& status, std::vector<size_t>& selection) {
+  selection.clear();
+  for (size_t i = 0; i < status.size(); ++i) {
+    if (status[i] == FrameStatus::Ok) selection.push_back(i);
+  }
+}
+
+void ByteParser::parseBatch(const char* data, size_t count, size_t stride, BatchResult& result) {
+  compile();
+  std::as_const(*this).parseBatch(data, count, stride, result);
+}
+
+void ByteParser::parseBatch(const char* data, size_t count, size_t stride, BatchResult& result, WorkerPool& pool) {
+  compile();
+  std::as_const(*this).parseBatch(data, count, stride, result, pool);
+}
+
+void ByteParser::parseBatch(const char* data, size_t count, size_t stride, BatchResult& result) const {
+  requireCompiled();
+  checkBatch(stride);
+  prepareBatch(count, result);
+  result.okCount_ = parseRows(data, 0, count, stride, result);
+  buildSelection(result.status_, result.selection_);
+}
+
+void ByteParser::parseBatch(const char* data, size_t count, size_t stride, BatchResult& result,
+                            WorkerPool& pool) const {
+  requireCompiled();
+  checkBatch(stride);
+  prepareBatch(count, result);
+  result.okCount_ = runParallel(count, pool, [&](size_t begin, size_t end) {
+    return parseRows(data, begin, end, stride, result);
+  });
+  buildSelection(result.status_, result.selection_);
+}
+
+size_t ByteParser::parseRows(const char* data, size_t begin, size_t end, size_t stride, BatchResult& result) const {
+  const size_t fieldCount = layout_->ops.size();
+  const FieldOp* ops = layout_->ops.data();
+  size_t okCount = 0;
+  for (size_t frame = begin; frame < end; ++frame) {
+    const char* ptr = data + frame * stride;
+    FrameStatus status = checkFrame(ptr);
+    result.status_[frame] = status;
+    if (status != FrameStatus::Ok) continue;
+
+    ParsedValue* out = result.values_.data() + frame * fieldCount;
+    for (size_t i = 0; i < fieldCount; ++i) {
+      out[i] = decodeField(ops[i], ptr);
     }
+    ++okCount;
   }
+  return okCount;
+}
 
-  // CRC Check
-  if (!crcAlgo_.empty() && crcLength_ > 0) {
-    if (size < crcLength_) {
-      throw std::runtime_error("[EasyByteParserCpp]: Buffer too small for CRC check");
+void ByteParser::prepareBatch(size_t count, BatchResult& result) const {
+  const size_t fieldCount = layout_->ops.size();
+  if (result.layout_ != layout_) {
+    result.layout_ = layout_;
+    result.fieldCount_ = fieldCount;
+    result.values_.clear();
+  }
+  // Only grows; shrinking keeps the capacity. New rows start as zeros of each field's type,
+  // so rows of rejected frames, which are never decoded, still hold the handle types.
+  const size_t filled = result.values_.size();
+  if (filled < count * fieldCount) {
+    result.values_.resize(count * fieldCount);
+    const FieldOp* ops = layout_->ops.data();
+    for (size_t i = filled; i < count * fieldCount; ++i) result.values_[i] = zeroValueOf(ops[i % fieldCount]);
+  }
+  result.status_.resize(count);
+}
+
+void ByteParser::decodeFrames(const char* const* frames, size_t count, BatchResult& result) const {
+  prepareBatch(count, result);
+  const size_t fieldCount = layout_->ops.size();
+  const FieldOp* ops = layout_->ops.data();
+  for (size_t frame = 0; frame < count; ++frame) {
+    result.status_[frame] = FrameStatus::Ok;
+    ParsedValue* out = result.values_.data() + frame * fieldCount;
+    for (size_t i = 0; i < fieldCount; ++i) {
+      out[i] = decodeField(ops[i], frames[frame]);
     }
+  }
+  result.okCount_ = count;
+  result.selection_.resize(count);
+  for (size_t frame = 0; frame < count; ++frame) result.selection_[frame] = frame;
+}
+
+// Column alternative used for the values of an op, see Column
+static size_t columnIndexOf(const FieldOp& op) {
+  if (op.type == FieldType::Bool) return static_cast<size_t>(FieldType::Bool);
+  if (op.type == FieldType::Float || op.type == FieldType::Double || op.needsScaling) {
+    return static_cast<size_t>(FieldType::Float);
+  }
+  // Bit fields are unsigned, the unsigned type precedes its signed counterpart
+  if (op.mask != 0) return static_cast<size_t>(op.type) & ~size_t(1);
+  return static_cast<size_t>(op.type);
+}
 
-    if (crcAlgo_ == "CRC16") {
-      // Calculate CRC on data range: [0, TotalLength - CRCLength)
-      size_t dataLen = totalLength_ - crcLength_;
-      uint16_t calculated = utils::calculateCRC16Modbus(reinterpret_cast<const uint8_t*>(data), dataLen);
+template <size_t I>
+static Column makeColumn(size_t index) {
+  if constexpr (I + 1 < std::variant_size_v<Column>) {
+    if (index != I) return makeColumn<I + 1>(index);
+  }
+  return Column(std::in_place_index<I>);
+}
 
-      const uint8_t* udata = reinterpret_cast<const uint8_t*>(data);
-      // CRC16 Modbus is usually Little Endian (or implementation specific, assuming Little Endian per Utils)
-      size_t crcOffset = totalLength_ - 2;
-      uint16_t received = udata[crcOffset] | (udata[crcOffset + 1] << 8);
+template <typename Raw>
+static void decodeIntegerColumn(const FieldOp& op, const char* data, size_t begin, size_t end, size_t stride,
+                                Column& column) {
+  using Unsigned = std::make_unsigned_t<Raw>;
+  const char* ptr = data + begin * stride + op.byteOffset;
+  if (op.needsScaling) {
+    double* out = std::get<std::vector<double>>(column).data();
+    for (size_t i = begin; i < end; ++i, ptr += stride) {
+      Raw raw = utils::readSwapped<Raw>(ptr, op.byteSwap);
+      double v = op.mask != 0 ? static_cast<double>((static_cast<Unsigned>(raw) >> op.shift) & op.mask)
+                              : static_cast<double>(raw);
+      out[i] = v * op.scale + op.bias;
+    }
+  } else if (op.mask != 0) {
+    Unsigned* out = std::get<std::vector<Unsigned>>(column).data();
+    for (size_t i = begin; i < end; ++i, ptr += stride) {
+      auto raw = utils::readSwapped<Unsigned>(ptr, op.byteSwap);
+      out[i] = static_cast<Unsigned>((raw >> op.shift) & op.mask);
+    }
+  } else {
+    Raw* out = std::get<std::vector<Raw>>(column).data();
+    for (size_t i = begin; i < end; ++i, ptr += stride) {
+      out[i] = utils::readSwapped<Raw>(ptr, op.byteSwap);
+    }
+  }
+}
 
-      if (calculated != received) {
-        throw std::runtime_error("[EasyByteParserCpp]: CRC Check Failed: calculated=" + std::to_string(calculated) +
-                                 ", received=" + std::to_string(received));
+// Scalar decode of frames [begin, end) of a column. For bool columns begin must be a multiple of 64.
+static void decodeColumnScalar(const FieldOp& op, const char* data, size_t begin, size_t end, size_t stride,
+                               Column& column) {
+  switch (op.type) {
+    case FieldType::UInt8:
+      return decodeIntegerColumn<uint8_t>(op, data, begin, end, stride, column);
+    case FieldType::Int8:
+      return decodeIntegerColumn<int8_t>(op, data, begin, end, stride, column);
+    case FieldType::UInt16:
+      return decodeIntegerColumn<uint16_t>(op, data, begin, end, stride, column);
+    case FieldType::Int16:
+      return decodeIntegerColumn<int16_t>(op, data, begin, end, stride, column);
+    case FieldType::UInt32:
+      return decodeIntegerColumn<uint32_t>(op, data, begin, end, stride, column);
+    case FieldType::Int32:
+      return decodeIntegerColumn<int32_t>(op, data, begin, end, stride, column);
+    case FieldType::UInt64:
+      return decodeIntegerColumn<uint64_t>(op, data, begin, end, stride, column);
+    case FieldType::Int64:
+      return decodeIntegerColumn<int64_t>(op, data, begin, end, stride, column);
+    case FieldType::Double: {
+      const char* ptr = data + begin * stride + op.byteOffset;
+      double* out = std::get<std::vector<double>>(column).data();
+      for (size_t i = begin; i < end; ++i, ptr += stride) {
+        auto raw = utils::readSwapped<double>(ptr, op.byteSwap);
+        out[i] = op.needsScaling ? raw * op.scale + op.bias : raw;
       }
-    } else {
-      throw std::runtime_error("[EasyByteParserCpp]: Unsupported CRC Algorithm: " + crcAlgo_);
+      return;
+    }
+    case FieldType::Float: {
+      const char* ptr = data + begin * stride + op.byteOffset;
+      double* out = std::get<std::vector<double>>(column).data();
+      for (size_t i = begin; i < end; ++i, ptr += stride) {
+        auto raw = static_cast<double>(utils::readSwapped<float>(ptr, op.byteSwap));
+        out[i] = op.needsScaling ? raw * op.scale + op.bias : raw;
+      }
+      return;
+    }
+    case FieldType::Bool: {
+      const char* ptr = data + begin * stride + op.byteOffset;
+      uint64_t* words = std::get<BitColumn>(column).words().data();
+      const unsigned shift = op.mask != 0 ? op.shift : 0;
+      for (size_t w = begin / 64; w * 64 < end; ++w) {
+        uint64_t word = 0;
+        size_t bits = std::min<size_t>(64, end - w * 64);
+        for (size_t b = 0; b < bits; ++b, ptr += stride) {
+          auto raw = static_cast<uint8_t>(*ptr);
+          uint64_t bit = op.mask != 0 ? (raw >> shift) & 1 : raw != 0;
+          word |= bit << b;
+        }
+        words[w] = word;
+      }
+      return;
     }
   }
+}
 
-  std::map<std::string, ParsedValue> result;
+// Scalar decode of the listed frames of a column
+static void decodeColumnFrames(const FieldOp& op, const char* data, const size_t* frames, size_t n, size_t stride,
+                               Column& column) {
+  if (op.type != FieldType::Bool) {
+    for (size_t k = 0; k < n; ++k) decodeColumnScalar(op, data, frames[k], frames[k] + 1, stride, column);
+    return;
+  }
+  uint64_t* words = std::get<BitColumn>(column).words().data();
+  for (size_t k = 0; k < n; ++k) {
+    const size_t frame = frames[k];
+    auto raw = static_cast<uint8_t>(data[frame * stride + op.byteOffset]);
+    const bool bit = op.mask != 0 ? (raw >> op.shift) & 1 : raw != 0;
+    const uint64_t mask = uint64_t(1) << (frame & 63);
+    words[frame >> 6] = bit ? words[frame >> 6] | mask : words[frame >> 6] & ~mask;
+  }
+}
 
-  for (const auto& field : fields_) {
-    // Offset checks already done in validateConfig, but safe to check again or trust
-    const char* ptr = data + field.byteOffset;
-    ParsedValue val;
-
-    if (field.type == "float") {
-      auto raw = utils::readFromBuffer<float>(ptr, field.isBigEndian);
-      val = ParsedValue(static_cast<double>(raw) * field.scale + field.bias);
-    } else if (field.type == "bool") {
-      auto raw = utils::readFromBuffer<uint8_t>(ptr, field.isBigEndian);
-      if (field.bitCount > 0) raw = (raw >> field.bitOffset) & 1;
-      val = ParsedValue(static_cast<bool>(raw));
-    } else {
-      // Integers
-      int64_t iVal = 0;
-      uint64_t uVal = 0;
-      bool isSigned = (field.type[0] == 'i');
-
-      if (field.type == "uint8")
-        uVal = utils::readFromBuffer<uint8_t>(ptr, field.isBigEndian);
-      else if (field.type == "int8")
-        iVal = utils::readFromBuffer<int8_t>(ptr, field.isBigEndian);
-      else if (field.type == "uint16")
-        uVal = utils::readFromBuffer<uint16_t>(ptr, field.isBigEndian);
-      else if (field.type == "int16")
-        iVal = utils::readFromBuffer<int16_t>(ptr, field.isBigEndian);
-      else if (field.type == "uint32")
-        uVal = utils::readFromBuffer<uint32_t>(ptr, field.isBigEndian);
-      else if (field.type == "int32")
-        iVal = utils::readFromBuffer<int32_t>(ptr, field.isBigEndian);
-
-      if (field.bitCount > 0) {
-        if (isSigned) uVal = static_cast<uint64_t>(iVal);  // treat as bits
-        uVal = (uVal >> field.bitOffset) & ((1ULL << field.bitCount) - 1);
-        isSigned = false;  // Result of bitfield extraction is usually treated as unsigned
-      }
+// Decode frames [begin, end) of a batch of \p count frames with the active SIMD kernel,
+// finishing the remaining frames in scalar code
+static void decodeColumn(const FieldOp& op, const char* data, size_t begin, size_t end, size_t count, size_t stride,
+                         size_t frameLength, Column& column) {
+  // Kernels fetch 4 bytes per field, trailing frames where that would leave the buffer are done in scalar code
+  size_t overrun = op.byteOffset + 4 > frameLength ? op.byteOffset + 4 - frameLength : 0;
+  size_t safeEnd = std::min(end, count - std::min(count, (overrun + stride - 1) / stride));
+  size_t next = begin < safeEnd ? simd::decodeColumn(op, data, begin, safeEnd, stride, column) : begin;
+  decodeColumnScalar(op, data, next, end, stride, column);
+}
 
-      if (field.scale != 1.0 || field.bias != 0.0) {
-        double d = isSigned ? static_cast<double>(iVal) : static_cast<double>(uVal);
-        val = ParsedValue(d * field.scale + field.bias);
-      } else {
-        if (isSigned)
-          val = ParsedValue(iVal);
-        else
-          val = ParsedValue(uVal);
+void ByteParser::parseBatch(const char* data, size_t count, size_t stride, ColumnarBatch& result) {
+  compile();
+  std::as_const(*this).parseBatch(data, count, stride, result);
+}
+
+void ByteParser::parseBatch(const char* data, size_t count, size_t stride, ColumnarBatch& result, WorkerPool& pool) {
+  compile();
+  std::as_const(*this).parseBatch(data, count, stride, result, pool);
+}
+
+void ByteParser::parseBatch(const char* data, size_t count, size_t stride, ColumnarBatch& result) const {
+  requireCompiled();
+  checkBatch(stride);
+  prepareColumns(count, result);
+  result.okCount_ = parseColumns(data, 0, count, count, stride, result);
+  buildSelection(result.status_, result.selection_);
+}
+
+void ByteParser::parseBatch(const char* data, size_t count, size_t stride, ColumnarBatch& result,
+                            WorkerPool& pool) const {
+  requireCompiled();
+  checkBatch(stride);
+  prepareColumns(count, result);
+  result.okCount_ = runParallel(count, pool, [&](size_t begin, size_t end) {
+    return parseColumns(data, begin, end, count, stride, result);
+  });
+  buildSelection(result.status_, result.selection_);
+}
+
+void ByteParser::prepareColumns(size_t count, ColumnarBatch& result) const {
+  if (result.layout_ != layout_) {
+    result.layout_ = layout_;
+    result.columns_.clear();
+    for (const auto& op : layout_->ops) result.columns_.push_back(makeColumn<0>(columnIndexOf(op)));
+  }
+
+  // Resize only grows the capacity
+  for (auto& column : result.columns_) {
+    std::visit([count](auto& col) { col.resize(count); }, column);
+  }
+  result.status_.resize(count);
+}
+
+// Field-major decode in blocks of frames that stay cache resident across all columns.
+// Blocks are a multiple of 64 frames so bool columns are written in whole words.
+constexpr size_t kBlockFrames = 512;
+
+size_t ByteParser::parseColumns(const char* data, size_t begin, size_t end, size_t count, size_t stride,
+                                ColumnarBatch& result) const {
+  const CompiledLayout& layout = *layout_;
+  const size_t fieldCount = layout.ops.size();
+  size_t okCount = 0;
+  size_t selected[kBlockFrames];
+  for (size_t blockBegin = begin; blockBegin < end; blockBegin += kBlockFrames) {
+    const size_t blockEnd = std::min(end, blockBegin + kBlockFrames);
+    size_t blockOk = 0;
+    for (size_t frame = blockBegin; frame < blockEnd; ++frame) {
+      FrameStatus status = checkFrame(data + frame * stride);
+      result.status_[frame] = status;
+      if (status == FrameStatus::Ok) selected[blockOk++] = frame;
+    }
+    okCount += blockOk;
+
+    // Blocks thinned out by filters decode only their surviving frames
+    if (!layout.filters.empty() && blockOk * 4 < blockEnd - blockBegin) {
+      for (size_t i = 0; i < fieldCount; ++i) {
+        decodeColumnFrames(layout.ops[i], data, selected, blockOk, stride, result.columns_[i]);
       }
+      continue;
+    }
+    for (size_t i = 0; i < fieldCount; ++i) {
+      decodeColumn(layout.ops[i], data, blockBegin, blockEnd, count, stride, totalLength_, result.columns_[i]);
     }
+  }
+  return okCount;
+}
+
+// Frames per task of the parallel batch modes, a multiple of kBlockFrames so that
+// tasks never share a word of a bool column
+constexpr size_t kParallelChunkFrames = 8 * kBlockFrames;
+
+template <typename ParseRange>
+size_t ByteParser::runParallel(size_t count, WorkerPool& pool, ParseRange&& parseRange) const {
+  const size_t chunks = (count + kParallelChunkFrames - 1) / kParallelChunkFrames;
+  if (chunks <= 1 || pool.threadCount() == 1) return parseRange(0, count);
+
+  // Each task writes only its own frame range of the preallocated output
+  std::vector<size_t> okCounts(chunks);
+  pool.run(chunks, [&](size_t chunk) {
+    const size_t begin = chunk * kParallelChunkFrames;
+    okCounts[chunk] = parseRange(begin, std::min(count, begin + kParallelChunkFrames));
+  });
+  size_t okCount = 0;
+  for (size_t n : okCounts) okCount += n;
+  return okCount;
+}
+
+void ByteParser::checksumOf(const char* data, uint32_t& calculated, uint32_t& received) const {
+  const uint8_t* udata = reinterpret_cast<const uint8_t*>(data);
+  calculated = checksum_->compute(udata + crcStart_, getCRCEnd() - crcStart_);
+  if (crcLength_ < 4) calculated &= (1u << (crcLength_ * 8)) - 1;
 
-    result[field.name] = val;
+  const uint8_t* field = udata + totalLength_ - crcLength_;
+  received = 0;
+  for (size_t i = 0; i < crcLength_; ++i) {
+    size_t shift = crcBigEndian_ ? (crcLength_ - 1 - i) * 8 : i * 8;
+    received |= static_cast<uint32_t>(field[i]) << shift;
   }
+}
 
-  return result;
+FrameStatus ByteParser::checkFrame(const char* data, size_t size) const {
+  return size < totalLength_ ? FrameStatus::TooShort : checkFrame(data);
+}
+
+bool ByteParser::passesFilters(const char* data) const {
+  for (const auto& filter : layout_->filters) {
+    const double v = numericValue(filter.field, data);
+    bool pass = false;
+    switch (filter.op) {
+      case CompareOp::Eq:
+        pass = v == filter.value;
+        break;
+      case CompareOp::Ne:
+        pass = v != filter.value;
+        break;
+      case CompareOp::Lt:
+        pass = v < filter.value;
+        break;
+      case CompareOp::Le:
+        pass = v <= filter.value;
+        break;
+      case CompareOp::Gt:
+        pass = v > filter.value;
+        break;
+      case CompareOp::Ge:
+        pass = v >= filter.value;
+        break;
+    }
+    if (!pass) return false;
+  }
+  return true;
+}
+
+FrameStatus ByteParser::checkFrame(const char* data) const {
+  if (!startCode_.empty() && std::memcmp(data, startCode_.data(), startCode_.size()) != 0) {
+    return FrameStatus::InvalidStartCode;
+  }
+  // Filters first: rejected frames cost a few loads instead of a CRC
+  if (!layout_->filters.empty() && !passesFilters(data)) return FrameStatus::Filtered;
+  return checkCrc(data);
+}
+
+FrameStatus ByteParser::checkCrc(const char* data) const {
+  if (checksum_) {
+    uint32_t calculated, received;
+    checksumOf(data, calculated, received);
+    if (calculated != received) return FrameStatus::CrcMismatch;
+  }
+  return FrameStatus::Ok;
+}
+
+void ByteParser::verifyFrame(const char* data, size_t size) const {
+  switch (checkFrame(data, size)) {
+    case FrameStatus::Ok:
+      return;
+    case FrameStatus::TooShort:
+      throw std::runtime_error("[EasyByteParserCpp]: Buffer size (" + std::to_string(size) +
+                               ") < Configured TotalLength (" + std::to_string(totalLength_) + ")");
+    case FrameStatus::InvalidStartCode: {
+      size_t i = 0;
+      while (static_cast<uint8_t>(data[i]) == startCode_[i]) ++i;
+      std::stringstream ss;
+      ss << "[EasyByteParserCpp]: Invalid Start Code at byte " << i << ". Expected 0x" << std::hex << std::setw(2)
+         << std::setfill('0') << (int)startCode_[i] << " but got 0x" << (int)(uint8_t)data[i];
+      throw std::runtime_error(ss.str());
+    }
+    case FrameStatus::CrcMismatch: {
+      uint32_t calculated, received;
+      checksumOf(data, calculated, received);
+      throw std::runtime_error("[EasyByteParserCpp]: CRC Check Failed: calculated=" + std::to_string(calculated) +
+                               ", received=" + std::to_string(received));
+    }
+    case FrameStatus::Filtered:
+      throw std::runtime_error("[EasyByteParserCpp]: Frame rejected by filter");
+  }
 }
 
 std::string ByteParser::dumpRaw(const std::map<std::string, ParsedValue>& data) {
@@ -369,6 +1397,14 @@ std::string ByteParser::dumpJson(const std::map<std::string, ParsedValue>& data)
   return j.dump(4);
 }
 
+std::string ByteParser::dumpRaw(const ParseResult& data) {
+  return dumpRaw(data.toMap());
+}
+
+std::string ByteParser::dumpJson(const ParseResult& data) {
+  return dumpJson(data.toMap());
+}
+
 std::string ByteParser::getConfigurationChecklist() const {
   std::stringstream ss;
   ss << "=== Parser Configuration Checklist ===\n";
@@ -384,8 +1420,14 @@ std::string ByteParser::getConfigurationChecklist() const {
   }
   ss << "\n";
 
-  ss << "3. CRC Config:   " << (crcAlgo_.empty() ? "None" : crcAlgo_ + " (Length: " + std::to_string(crcLength_) + ")")
-     << "\n";
+  ss << "3. CRC Config:   ";
+  if (crcAlgo_.empty()) {
+    ss << "None";
+  } else {
+    ss << crcAlgo_ << " (Length: " << crcLength_ << ", " << (crcBigEndian_ ? "Big" : "Little")
+       << " Endian, Bytes " << crcStart_ << ".." << getCRCEnd() << ")";
+  }
+  ss << "\n";
 
   ss << "4. Fields Layout (" << fields_.size() << " fields):\n";
   ss << std::setfill(' ');
@@ -0,0 +1,164 @@
+#include "EasyByteParserCpp/Checksum.hpp"
+
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+
+#include "CrcEngine.hpp"
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define EBP_CRC32C_X86 1
+#include <cpuid.h>
+#include <immintrin.h>
+#define EBP_TARGET_SSE42 __attribute__((target("sse4.2")))
+#else
+#define EBP_CRC32C_X86 0
+#endif
+
+namespace easy_byte_parser {
+namespace checksum {
+
+namespace {
+
+/// Table-driven CRC16 for non-reflected (MSB-first) variants such as CCITT and XMODEM.
+class Crc16Msb {
+ public:
+  Crc16Msb(uint16_t poly, uint16_t init) : init_(init) {
+    for (uint32_t i = 0; i < 256; ++i) {
+      uint16_t crc = static_cast<uint16_t>(i << 8);
+      for (int j = 0; j < 8; ++j) crc = (crc & 0x8000) ? static_cast<uint16_t>((crc << 1) ^ poly) : crc << 1;
+      table_[i] = crc;
+    }
+  }
+
+  uint32_t compute(const uint8_t* data, size_t length) const {
+    uint16_t crc = init_;
+    for (size_t i = 0; i < length; ++i) crc = static_cast<uint16_t>((crc << 8) ^ table_[(crc >> 8) ^ data[i]]);
+    return crc;
+  }
+
+ private:
+  uint16_t init_;
+  uint16_t table_[256];
+};
+
+const utils::CrcEngine& crc32Engine() {
+  static const utils::CrcEngine engine({32, 0x04C11DB7, 0xFFFFFFFF, 0xFFFFFFFF});
+  return engine;
+}
+
+const utils::CrcEngine& crc32cEngine() {
+  static const utils::CrcEngine engine({32, 0x1EDC6F41, 0xFFFFFFFF, 0xFFFFFFFF});
+  return engine;
+}
+
+#if EBP_CRC32C_X86
+
+EBP_TARGET_SSE42 uint32_t crc32cHardware(const uint8_t* data, size_t length) {
+  uint64_t crc = 0xFFFFFFFF;
+  while (length >= 8) {
+    uint64_t word;
+    std::memcpy(&word, data, 8);
+    crc = _mm_crc32_u64(crc, word);
+    data += 8;
+    length -= 8;
+  }
+  uint32_t crc32 = static_cast<uint32_t>(crc);
+  for (size_t i = 0; i < length; ++i) crc32 = _mm_crc32_u8(crc32, data[i]);
+  return crc32 ^ 0xFFFFFFFF;
+}
+
+bool sse42Supported() {
+  unsigned eax, ebx, ecx, edx;
+  if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx)) return false;
+  return ecx & bit_SSE4_2;
+}
+
+#endif
+
+uint32_t crc32c(const uint8_t* data, size_t length) {
+#if EBP_CRC32C_X86
+  static const bool hardware = sse42Supported();
+  if (hardware) return crc32cHardware(data, length);
+#endif
+  return crc32cEngine().compute(data, length);
+}
+
+uint32_t sum8(const uint8_t* data, size_t length) {
+  uint8_t sum = 0;
+  for (size_t i = 0; i < length; ++i) sum = static_cast<uint8_t>(sum + data[i]);
+  return sum;
+}
+
+uint32_t xor8(const uint8_t* data, size_t length) {
+  uint8_t x = 0;
+  for (size_t i = 0; i < length; ++i) x ^= data[i];
+  return x;
+}
+
+struct Registry {
+  std::mutex mutex;
+  std::map<std::string, std::shared_ptr<const ChecksumAlgorithm>> algorithms;
+
+  Registry() {
+    auto modbus = [](const uint8_t* data, size_t length) { return utils::crc16ModbusEngine().compute(data, length); };
+    auto ccitt = std::make_shared<const Crc16Msb>(0x1021, 0xFFFF);
+    auto xmodem = std::make_shared<const Crc16Msb>(0x1021, 0x0000);
+
+    add({"CRC16", 2, modbus});
+    add({"CRC16-MODBUS", 2, modbus});
+    add({"CRC16-CCITT", 2, [ccitt](const uint8_t* data, size_t length) { return ccitt->compute(data, length); }});
+    add({"CRC16-XMODEM", 2, [xmodem](const uint8_t* data, size_t length) { return xmodem->compute(data, length); }});
+    add({"CRC32", 4, [](const uint8_t* data, size_t length) { return crc32Engine().compute(data, length); }});
+    add({"CRC32C", 4, crc32c});
+    add({"SUM8", 1, sum8});
+    add({"XOR8", 1, xor8});
+  }
+
+  void add(ChecksumAlgorithm algorithm) {
+    std::string name = algorithm.name;
+    algorithms[name] = std::make_shared<const ChecksumAlgorithm>(std::move(algorithm));
+  }
+};
+
+Registry& registry() {
+  static Registry instance;
+  return instance;
+}
+
+}  // namespace
+
+void registerAlgorithm(ChecksumAlgorithm algorithm) {
+  if (algorithm.name.empty()) {
+    throw std::runtime_error("[EasyByteParserCpp]: Checksum algorithm name must not be empty");
+  }
+  if (algorithm.length < 1 || algorithm.length > 4) {
+    throw std::runtime_error("[EasyByteParserCpp]: Checksum length must be 1 to 4 bytes for " + algorithm.name);
+  }
+  if (!algorithm.compute) {
+    throw std::runtime_error("[EasyByteParserCpp]: Missing compute function for checksum " + algorithm.name);
+  }
+  Registry& r = registry();
+  std::lock_guard<std::mutex> lock(r.mutex);
+  r.add(std::move(algorithm));
+}
+
+std::shared_ptr<const ChecksumAlgorithm> find(const std::string& name) {
+  Registry& r = registry();
+  std::lock_guard<std::mutex> lock(r.mutex);
+  auto it = r.algorithms.find(name);
+  return it == r.algorithms.end() ? nullptr : it->second;
+}
+
+std::vector<std::string> names() {
+  Registry& r = registry();
+  std::lock_guard<std::mutex> lock(r.mutex);
+  std::vector<std::string> out;
+  out.reserve(r.algorithms.size());
+  for (const auto& entry : r.algorithms) out.push_back(entry.first);
+  return out;
+}
+
+}  // namespace checksum
+}  // namespace easy_byte_parser
@@ -0,0 +1,171 @@
+#include "CrcEngine.hpp"
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define EBP_CLMUL_X86 1
+#include <cpuid.h>
+#include <immintrin.h>
+#define EBP_TARGET_CLMUL __attribute__((target("pclmul,sse4.1")))
+#else
+#define EBP_CLMUL_X86 0
+#endif
+
+namespace easy_byte_parser {
+namespace utils {
+
+namespace {
+
+// Folding needs at least one 64-byte block, from there on it beats the tables
+constexpr size_t kMinClmulLength = 64;
+
+uint32_t reflect(uint32_t value, unsigned width) {
+  uint32_t out = 0;
+  for (unsigned i = 0; i < width; ++i)
+    if (value & (1u << i)) out |= 1u << (width - 1 - i);
+  return out;
+}
+
+// x^n mod P in normal form, bit d holds the coefficient of x^d
+uint32_t xPowMod(unsigned n, const CrcParams& p) {
+  const uint64_t top = 1ULL << p.width;
+  uint64_t r = 1;
+  for (unsigned i = 0; i < n; ++i) {
+    r <<= 1;
+    if (r & top) r ^= top | p.poly;
+  }
+  return static_cast<uint32_t>(r);
+}
+
+// Polynomial of degree < 64 as a bit-reflected qword: the coefficient of x^d goes to bit 63 - d
+uint64_t toReflectedQword(uint32_t poly, unsigned width) {
+  uint64_t q = 0;
+  for (unsigned d = 0; d < width; ++d)
+    if (poly & (1u << d)) q |= 1ULL << (63 - d);
+  return q;
+}
+
+#if EBP_CLMUL_X86
+
+// With bit-reflected operands PCLMULQDQ yields x * a * b. A 128-bit lane holds lo * x^64 + hi,
+// so shifting it by D bits means multiplying lo by x^(D+63) and hi by x^(D-1) (mod P).
+EBP_TARGET_CLMUL inline __m128i fold(__m128i x, __m128i k) {
+  return _mm_xor_si128(_mm_clmulepi64_si128(x, k, 0x00), _mm_clmulepi64_si128(x, k, 0x11));
+}
+
+EBP_TARGET_CLMUL inline __m128i load(const uint8_t* p) {
+  return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+}
+
+#endif
+
+}  // namespace
+
+CrcEngine::CrcEngine(const CrcParams& params) : params_(params) {
+  const uint32_t reflectedPoly = reflect(params.poly, params.width);
+  for (uint32_t i = 0; i < 256; ++i) {
+    uint32_t crc = i;
+    for (int j = 0; j < 8; ++j) crc = (crc & 1) ? (crc >> 1) ^ reflectedPoly : crc >> 1;
+    table_[0][i] = crc;
+  }
+  for (int k = 1; k < 8; ++k) {
+    for (uint32_t i = 0; i < 256; ++i) {
+      uint32_t prev = table_[k - 1][i];
+      table_[k][i] = (prev >> 8) ^ table_[0][prev & 0xFF];
+    }
+  }
+
+  fold512_[0] = toReflectedQword(xPowMod(512 + 63, params), params.width);
+  fold512_[1] = toReflectedQword(xPowMod(512 - 1, params), params.width);
+  fold128_[0] = toReflectedQword(xPowMod(128 + 63, params), params.width);
+  fold128_[1] = toReflectedQword(xPowMod(128 - 1, params), params.width);
+}
+
+uint32_t CrcEngine::update(uint32_t crc, const uint8_t* data, size_t length) const {
+  static const bool clmul = clmulSupported();
+  if (clmul && length >= kMinClmulLength) return updateClmul(crc, data, length);
+  return updateTable(crc, data, length);
+}
+
+uint32_t CrcEngine::updateTable(uint32_t crc, const uint8_t* data, size_t length) const {
+  // The register occupies the low bytes of the first word, so one XOR mixes it in for any width up to 32.
+  // The word is assembled little-endian on any host; compilers fold it into a single load where possible.
+  while (length >= 8) {
+    uint64_t word = 0;
+    for (int i = 7; i >= 0; --i) word = (word << 8) | data[i];
+    word ^= crc;
+    crc = table_[7][word & 0xFF] ^ table_[6][(word >> 8) & 0xFF] ^ table_[5][(word >> 16) & 0xFF] ^
+          table_[4][(word >> 24) & 0xFF] ^ table_[3][(word >> 32) & 0xFF] ^ table_[2][(word >> 40) & 0xFF] ^
+          table_[1][(word >> 48) & 0xFF] ^ table_[0][word >> 56];
+    data += 8;
+    length -= 8;
+  }
+  for (size_t i = 0; i < length; ++i) crc = (crc >> 8) ^ table_[0][(crc ^ data[i]) & 0xFF];
+  return crc;
+}
+
+#if EBP_CLMUL_X86
+
+EBP_TARGET_CLMUL uint32_t CrcEngine::updateClmul(uint32_t crc, const uint8_t* data, size_t length) const {
+  if (length < 64) return updateTable(crc, data, length);
+
+  const __m128i k512 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(fold512_));
+  const __m128i k128 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(fold128_));
+
+  // A reflected CRC with register value r equals a zero-initialized CRC over data whose first bytes are XORed with r
+  __m128i x0 = _mm_xor_si128(load(data), _mm_cvtsi32_si128(static_cast<int>(crc)));
+  __m128i x1 = load(data + 16);
+  __m128i x2 = load(data + 32);
+  __m128i x3 = load(data + 48);
+  data += 64;
+  length -= 64;
+
+  // Four independent lanes hide the multiplier latency
+  while (length >= 64) {
+    x0 = _mm_xor_si128(fold(x0, k512), load(data));
+    x1 = _mm_xor_si128(fold(x1, k512), load(data + 16));
+    x2 = _mm_xor_si128(fold(x2, k512), load(data + 32));
+    x3 = _mm_xor_si128(fold(x3, k512), load(data + 48));
+    data += 64;
+    length -= 64;
+  }
+
+  x1 = _mm_xor_si128(x1, fold(x0, k128));
+  x2 = _mm_xor_si128(x2, fold(x1, k128));
+  x3 = _mm_xor_si128(x3, fold(x2, k128));
+  while (length >= 16) {
+    x3 = _mm_xor_si128(fold(x3, k128), load(data));
+    data += 16;
+    length -= 16;
+  }
+
+  // The remaining 128-bit lane is reduced by the table path, then the tail continues from it
+  alignas(16) uint8_t lane[16];
+  _mm_store_si128(reinterpret_cast<__m128i*>(lane), x3);
+  crc = updateTable(0, lane, sizeof(lane));
+  return updateTable(crc, data, length);
+}
+
+bool CrcEngine::clmulSupported() {
+  unsigned eax, ebx, ecx, edx;
+  if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx)) return false;
+  return (ecx & bit_PCLMUL) && (ecx & bit_SSE4_1);
+}
+
+#else
+
+uint32_t CrcEngine::updateClmul(uint32_t crc, const uint8_t* data, size_t length) const {
+  return updateTable(crc, data, length);
+}
+
+bool CrcEngine::clmulSupported() {
+  return false;
+}
+
+#endif
+
+const CrcEngine& crc16ModbusEngine() {
+  static const CrcEngine engine({16, 0x8005, 0xFFFF, 0x0000});
+  return engine;
+}
+
+}  // namespace utils
+}  // namespace easy_byte_parser
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace easy_byte_parser {
+namespace utils {
+
+/// Parameters of a reflected (LSB-first) CRC of up to 32 bits.
+struct CrcParams {
+  unsigned width;   // Register width in bits
+  uint32_t poly;    // Polynomial in normal (MSB-first) form without the x^width term, e.g. 0x8005
+  uint32_t init;    // Initial register value
+  uint32_t xorOut;  // Value XORed into the final register
+};
+
+/// Reusable CRC engine for reflected CRCs such as CRC16-MODBUS and CRC32.
+/// Short inputs use slicing-by-8 tables; longer inputs are folded 64 bytes at a time
+/// with carry-less multiplication (PCLMULQDQ) when the CPU supports it.
+class CrcEngine {
+ public:
+  explicit CrcEngine(const CrcParams& params);
+
+  /// CRC of a complete message.
+  /// \param data Pointer to data buffer
+  /// \param length Length of data
+  /// \return CRC value
+  [[nodiscard]] uint32_t compute(const uint8_t* data, size_t length) const {
+    return update(params_.init, data, length) ^ params_.xorOut;
+  }
+
+  /// Continue a CRC register over more data, without init or final XOR.
+  [[nodiscard]] uint32_t update(uint32_t crc, const uint8_t* data, size_t length) const;
+
+  /// Table path only (slicing-by-8).
+  [[nodiscard]] uint32_t updateTable(uint32_t crc, const uint8_t* data, size_t length) const;
+
+  /// Folding path. Must only be called if clmulSupported().
+  [[nodiscard]] uint32_t updateClmul(uint32_t crc, const uint8_t* data, size_t length) const;
+
+  [[nodiscard]] const CrcParams& params() const {
+    return params_;
+  }
+
+  /// True if the running CPU provides PCLMULQDQ and the engine was built with it.
+  static bool clmulSupported();
+
+ private:
+  CrcParams params_;
+  uint32_t table_[8][256];
+  uint64_t fold512_[2];  // Constants folding a 128-bit lane over 512 bits
+  uint64_t fold128_[2];  // Constants folding a 128-bit lane over 128 bits
+};
+
+/// Shared engine for CRC16-MODBUS (poly 0x8005 reflected, init 0xFFFF).
+const CrcEngine& crc16ModbusEngine();
+
+}  // namespace utils
+}  // namespace easy_byte_parser
@@ -0,0 +1,129 @@
+#include "EasyByteParserCpp/ByteParser.hpp"
+
+#include "EasyByteParserCpp/WorkerPool.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define EBP_HAVE_MMAP 1
+#else
+#define EBP_HAVE_MMAP 0
+#endif
+
+namespace easy_byte_parser {
+
+namespace {
+
+/// Read-only view of a whole file, memory-mapped where available and read into memory otherwise.
+class MappedFile {
+ public:
+  explicit MappedFile(const std::string& path) {
+#if EBP_HAVE_MMAP
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) throw std::runtime_error("[EasyByteParserCpp]: Cannot open file: " + path);
+    struct stat st {};
+    if (fstat(fd, &st) != 0) {
+      close(fd);
+      throw std::runtime_error("[EasyByteParserCpp]: Cannot stat file: " + path);
+    }
+    size_ = static_cast<size_t>(st.st_size);
+    if (size_ > 0) {
+      void* p = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+      if (p == MAP_FAILED) {
+        close(fd);
+        throw std::runtime_error("[EasyByteParserCpp]: Cannot map file: " + path);
+      }
+      data_ = static_cast<const char*>(p);
+      // Hints only, failures are harmless
+      madvise(p, size_, MADV_SEQUENTIAL);
+#ifdef MADV_HUGEPAGE
+      madvise(p, size_, MADV_HUGEPAGE);
+#endif
+    }
+    close(fd);
+#else
+    std::ifstream file(path, std::ios::binary);
+    if (!file) throw std::runtime_error("[EasyByteParserCpp]: Cannot open file: " + path);
+    buffer_.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    data_ = buffer_.data();
+    size_ = buffer_.size();
+#endif
+  }
+
+  ~MappedFile() {
+#if EBP_HAVE_MMAP
+    if (data_) munmap(const_cast<char*>(data_), size_);
+#endif
+  }
+
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  [[nodiscard]] const char* data() const {
+    return data_;
+  }
+
+  [[nodiscard]] size_t size() const {
+    return size_;
+  }
+
+ private:
+  const char* data_ = nullptr;
+  size_t size_ = 0;
+#if !EBP_HAVE_MMAP
+  std::vector<char> buffer_;
+#endif
+};
+
+}  // namespace
+
+template <typename Batch, typename Sink>
+FileParseStats ByteParser::parseFileInto(const std::string& path, const Sink& sink, size_t framesPerBatch,
+                                         WorkerPool* pool) {
+  if (framesPerBatch == 0) throw std::runtime_error("[EasyByteParserCpp]: framesPerBatch must be greater than 0");
+  compile();
+  const auto start = std::chrono::steady_clock::now();
+
+  MappedFile file(path);
+  FileParseStats stats;
+  stats.bytes = file.size();
+  const size_t frameCount = file.size() / totalLength_;
+  stats.trailingBytes = file.size() - frameCount * totalLength_;
+
+  Batch batch;
+  for (size_t first = 0; first < frameCount; first += framesPerBatch) {
+    const size_t count = std::min(framesPerBatch, frameCount - first);
+    if (pool) {
+      parseBatch(file.data() + first * totalLength_, count, totalLength_, batch, *pool);
+    } else {
+      parseBatch(file.data() + first * totalLength_, count, totalLength_, batch);
+    }
+    stats.frames += count;
+    stats.okFrames += batch.okCount();
+    sink(batch, first);
+  }
+
+  stats.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  return stats;
+}
+
+FileParseStats ByteParser::parseFile(const std::string& path, const BatchSink& sink, size_t framesPerBatch,
+                                     WorkerPool* pool) {
+  return parseFileInto<BatchResult>(path, sink, framesPerBatch, pool);
+}
+
+FileParseStats ByteParser::parseFile(const std::string& path, const ColumnarSink& sink, size_t framesPerBatch,
+                                     WorkerPool* pool) {
+  return parseFileInto<ColumnarBatch>(path, sink, framesPerBatch, pool);
+}
+
+}  // namespace easy_byte_parser
@@ -0,0 +1,213 @@
+#include "Jit.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+
+// x86-64 System V only: the generated code takes its arguments in rdi / rsi
+#if defined(EBP_ENABLE_JIT) && defined(__x86_64__) && !defined(_WIN32)
+#define EBP_JIT_X86_64 1
+#include <sys/mman.h>
+#include <unistd.h>
+#else
+#define EBP_JIT_X86_64 0
+#endif
+
+namespace easy_byte_parser {
+namespace jit {
+
+#if EBP_JIT_X86_64
+
+namespace {
+
+/// Machine code buffer with the few instructions needed to decode fields.
+/// Frame pointer in rdi, slot array in rsi; rax, rcx, xmm0 and xmm1 are scratch.
+class Emitter {
+ public:
+  const std::vector<uint8_t>& code() const {
+    return code_;
+  }
+
+  void field(const FieldOp& op, uint32_t slot) {
+    const auto offset = static_cast<uint32_t>(op.byteOffset);
+    switch (op.type) {
+      case FieldType::Bool:
+        emit({0x0F, 0xB6, 0x87}, offset);  // movzx eax, byte [rdi + offset]
+        if (op.mask != 0) {
+          emit({0xC1, 0xE8, op.shift});  // shr eax, shift
+          emit({0x83, 0xE0, 0x01});  // and eax, 1
+        } else {
+          emit({0x84, 0xC0});  // test al, al
+          emit({0x0F, 0x95, 0xC0});  // setne al
+          emit({0x0F, 0xB6, 0xC0});  // movzx eax, al
+        }
+        return storeInteger(slot);
+      case FieldType::Float:
+        emit({0x8B, 0x87}, offset);  // mov eax, [rdi + offset]
+        if (op.byteSwap) emit({0x0F, 0xC8});  // bswap eax
+        emit({0x66, 0x0F, 0x6E, 0xC0});  // movd xmm0, eax
+        emit({0xF3, 0x0F, 0x5A, 0xC0});  // cvtss2sd xmm0, xmm0
+        if (op.needsScaling) scale(op);
+        return storeDouble(slot);
+      case FieldType::Double:
+        emit({0x48, 0x8B, 0x87}, offset);  // mov rax, [rdi + offset]
+        if (op.byteSwap) emit({0x48, 0x0F, 0xC8});  // bswap rax
+        if (!op.needsScaling) return storeInteger(slot);  // The slot holds the bits of the double
+        emit({0x66, 0x48, 0x0F, 0x6E, 0xC0});  // movq xmm0, rax
+        scale(op);
+        return storeDouble(slot);
+      default:
+        break;
+    }
+
+    // Integers: bit fields are extracted from the zero-extended raw value, like the interpreter
+    const bool isSigned = op.type == FieldType::Int8 || op.type == FieldType::Int16 || op.type == FieldType::Int32 ||
+                          op.type == FieldType::Int64;
+    const bool signExtend = isSigned && op.mask == 0;
+    switch (op.type) {
+      case FieldType::UInt8:
+      case FieldType::Int8:
+        if (signExtend)
+          emit({0x48, 0x0F, 0xBE, 0x87}, offset);  // movsx rax, byte [rdi + offset]
+        else
+          emit({0x0F, 0xB6, 0x87}, offset);  // movzx eax, byte [rdi + offset]
+        break;
+      case FieldType::UInt16:
+      case FieldType::Int16:
+        emit({0x0F, 0xB7, 0x87}, offset);  // movzx eax, word [rdi + offset]
+        if (op.byteSwap) emit({0x66, 0xC1, 0xC0, 0x08});  // rol ax, 8
+        if (signExtend) emit({0x48, 0x0F, 0xBF, 0xC0});  // movsx rax, ax
+        break;
+      case FieldType::UInt64:
+      case FieldType::Int64:
+        emit({0x48, 0x8B, 0x87}, offset);  // mov rax, [rdi + offset]
+        if (op.byteSwap) emit({0x48, 0x0F, 0xC8});  // bswap rax
+        break;
+      default:
+        emit({0x8B, 0x87}, offset);  // mov eax, [rdi + offset]
+        if (op.byteSwap) emit({0x0F, 0xC8});  // bswap eax
+        if (signExtend) emit({0x48, 0x63, 0xC0});  // movsxd rax, eax
+        break;
+    }
+    if (op.mask != 0) {
+      if (op.shift != 0) emit({0x48, 0xC1, 0xE8, op.shift});  // shr rax, shift
+      if (op.mask > UINT32_MAX) {
+        emit({0x48, 0xB9});  // mov rcx, imm64
+        emit64(op.mask);
+      } else {
+        emit({0xB9}, static_cast<uint32_t>(op.mask));  // mov ecx, mask
+      }
+      emit({0x48, 0x21, 0xC8});  // and rax, rcx
+    }
+    if (!op.needsScaling) return storeInteger(slot);
+    emit({0x66, 0x0F, 0xEF, 0xC0});  // pxor xmm0, xmm0 (breaks the dependency of cvtsi2sd)
+    // Unsigned values with the top bit possibly set: rax >= 2^63 is halved with its lowest bit
+    // kept for rounding, converted and doubled, as compilers convert uint64_t to double
+    if (op.mask != 0 ? (op.mask >> 63) != 0 : op.type == FieldType::UInt64) {
+      emit({0x48, 0x85, 0xC0});  // test rax, rax
+      emit({0x78, 0x07});  // js +7
+      emit({0xF2, 0x48, 0x0F, 0x2A, 0xC0});  // cvtsi2sd xmm0, rax
+      emit({0xEB, 0x15});  // jmp +21
+      emit({0x48, 0x89, 0xC1});  // mov rcx, rax
+      emit({0x48, 0xD1, 0xE9});  // shr rcx, 1
+      emit({0x83, 0xE0, 0x01});  // and eax, 1
+      emit({0x48, 0x09, 0xC1});  // or rcx, rax
+      emit({0xF2, 0x48, 0x0F, 0x2A, 0xC1});  // cvtsi2sd xmm0, rcx
+      emit({0xF2, 0x0F, 0x58, 0xC0});  // addsd xmm0, xmm0
+    } else {
+      emit({0xF2, 0x48, 0x0F, 0x2A, 0xC0});  // cvtsi2sd xmm0, rax
+    }
+    scale(op);
+    storeDouble(slot);
+  }
+
+  void ret() {
+    emit({0xC3});
+  }
+
+ private:
+  void emit(std::initializer_list<uint8_t> bytes) {
+    code_.insert(code_.end(), bytes);
+  }
+
+  void emit(std::initializer_list<uint8_t> bytes, uint32_t imm) {
+    emit(bytes);
+    for (int i = 0; i < 4; ++i) code_.push_back(static_cast<uint8_t>(imm >> (8 * i)));
+  }
+
+  void emit64(uint64_t imm) {
+    for (int i = 0; i < 8; ++i) code_.push_back(static_cast<uint8_t>(imm >> (8 * i)));
+  }
+
+  void loadConstant(double value) {
+    uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    emit({0x48, 0xB8});  // mov rax, imm64
+    emit64(bits);
+    emit({0x66, 0x48, 0x0F, 0x6E, 0xC8});  // movq xmm1, rax
+  }
+
+  // value * scale + bias as two roundings, the bias is added even if 0 (-0.0 + 0.0 is +0.0)
+  void scale(const FieldOp& op) {
+    loadConstant(op.scale);
+    emit({0xF2, 0x0F, 0x59, 0xC1});  // mulsd xmm0, xmm1
+    loadConstant(op.bias);
+    emit({0xF2, 0x0F, 0x58, 0xC1});  // addsd xmm0, xmm1
+  }
+
+  void storeInteger(uint32_t slot) {
+    emit({0x48, 0x89, 0x86}, slot * 8);  // mov [rsi + slot * 8], rax
+  }
+
+  void storeDouble(uint32_t slot) {
+    emit({0xF2, 0x0F, 0x11, 0x86}, slot * 8);  // movsd [rsi + slot * 8], xmm0
+  }
+
+  std::vector<uint8_t> code_;
+};
+
+}  // namespace
+
+bool isSupported() {
+  return true;
+}
+
+std::shared_ptr<const void> compile(const std::vector<FieldOp>& ops, FlatDecodeFn& fn) {
+  // All displacements are 32 bit
+  if (ops.size() > (UINT32_MAX >> 4)) return nullptr;
+  Emitter emitter;
+  for (size_t i = 0; i < ops.size(); ++i) {
+    if (ops[i].byteOffset > INT32_MAX) return nullptr;
+    emitter.field(ops[i], static_cast<uint32_t>(i));
+  }
+  emitter.ret();
+
+  // Written while writable, then switched to read + execute: never writable and executable at once
+  const std::vector<uint8_t>& code = emitter.code();
+  const size_t page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  const size_t size = (code.size() + page - 1) / page * page;
+  void* memory = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (memory == MAP_FAILED) return nullptr;
+  std::memcpy(memory, code.data(), code.size());
+  if (mprotect(memory, size, PROT_READ | PROT_EXEC) != 0) {
+    munmap(memory, size);
+    return nullptr;  // E.g. denied by a W^X policy
+  }
+  fn = reinterpret_cast<FlatDecodeFn>(memory);
+  return std::shared_ptr<const void>(memory, [size](const void* p) { munmap(const_cast<void*>(p), size); });
+}
+
+#else
+
+bool isSupported() {
+  return false;
+}
+
+std::shared_ptr<const void> compile(const std::vector<FieldOp>&, FlatDecodeFn&) {
+  return nullptr;
+}
+
+#endif
+
+}  // namespace jit
+}  // namespace easy_byte_parser
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "EasyByteParserCpp/ByteParser.hpp"
+
+namespace easy_byte_parser {
+namespace jit {
+
+/// True if this build and platform can generate machine code (ENABLE_JIT, x86-64, POSIX mmap).
+bool isSupported();
+
+/// Generate a function storing the value of ops[i] in slot i, encoded as in FlatResult.
+/// The code is written to a private mapping that is made read-only and executable before use.
+/// \param ops Compiled field ops
+/// \param fn Receives the entry point
+/// \return Owner of the code page, nullptr (and \p fn unchanged) if unsupported
+std::shared_ptr<const void> compile(const std::vector<FieldOp>& ops, FlatDecodeFn& fn);
+
+}  // namespace jit
+}  // namespace easy_byte_parser
@@ -0,0 +1,109 @@
+#include "EasyByteParserCpp/RingBuffer.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace easy_byte_parser {
+
+static size_t roundUpPow2(size_t value) {
+  size_t result = 1;
+  while (result < value) result <<= 1;
+  return result;
+}
+
+RingBuffer::RingBuffer(size_t capacity, size_t slack, bool mirror) : slack_(slack) {
+  if (capacity == 0) throw std::invalid_argument("[EasyByteParserCpp]: RingBuffer capacity must be greater than 0");
+  if (slack > capacity) throw std::invalid_argument("[EasyByteParserCpp]: RingBuffer slack exceeds capacity");
+
+  if (mirror && mapMirrored(capacity)) return;
+  mask_ = roundUpPow2(capacity) - 1;
+  data_ = new char[mask_ + 1 + slack_];
+}
+
+RingBuffer::~RingBuffer() {
+#if defined(__linux__) && defined(MFD_CLOEXEC)
+  if (mirrored_) {
+    munmap(data_, 2 * capacity());
+    return;
+  }
+#endif
+  delete[] data_;
+}
+
+bool RingBuffer::mapMirrored(size_t capacity) {
+#if defined(__linux__) && defined(MFD_CLOEXEC)
+  const auto page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  const size_t size = roundUpPow2(std::max(capacity, page));
+
+  int fd = memfd_create("EasyByteParserCpp.ring", MFD_CLOEXEC);
+  if (fd < 0) return false;
+  if (ftruncate(fd, static_cast<off_t>(size)) != 0) {
+    close(fd);
+    return false;
+  }
+  // Reserve twice the size, then map the file over both halves
+  void* base = mmap(nullptr, 2 * size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  bool ok = base != MAP_FAILED;
+  if (ok) {
+    char* p = static_cast<char*>(base);
+    ok = mmap(p, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) != MAP_FAILED &&
+         mmap(p + size, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) != MAP_FAILED;
+    if (!ok) munmap(base, 2 * size);
+  }
+  close(fd);
+  if (!ok) return false;
+
+  data_ = static_cast<char*>(base);
+  mask_ = size - 1;
+  mirrored_ = true;
+  return true;
+#else
+  (void)capacity;
+  return false;
+#endif
+}
+
+size_t RingBuffer::write(const char* data, size_t size) {
+  size_t written = 0;
+  while (written < size) {
+    size_t n = std::min(size - written, writableContiguous());
+    if (n == 0) break;
+    std::memcpy(writePtr(), data + written, n);
+    commit(n);
+    written += n;
+  }
+  return written;
+}
+
+size_t RingBuffer::writableContiguous() const {
+  if (mirrored_) return writable();
+  return std::min(writable(), capacity() - static_cast<size_t>(tail_ & mask_));
+}
+
+void RingBuffer::commit(size_t size) {
+  if (!mirrored_) {
+    // Bytes landing in the first slack_ bytes are also needed behind the end
+    const size_t pos = static_cast<size_t>(tail_ & mask_);
+    if (pos < slack_) {
+      std::memcpy(data_ + capacity() + pos, data_ + pos, std::min(size, slack_ - pos));
+    }
+  }
+  tail_ += size;
+}
+
+size_t RingBuffer::readableContiguous() const {
+  if (mirrored_) return readable();
+  return std::min(readable(), capacity() + slack_ - static_cast<size_t>(head_ & mask_));
+}
+
+void RingBuffer::consume(size_t size) {
+  head_ += size;
+}
+
+}  // namespace easy_byte_parser
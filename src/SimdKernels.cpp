@@ -0,0 +1,458 @@
+#include "SimdKernels.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <climits>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <variant>
+
+#include "Utils.hpp"
+
+// Kernels are compiled per function with target attributes and selected at runtime,
+// so the library itself does not require any -m flags. Other compilers use the scalar path.
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define EBP_SIMD_X86 1
+#include <immintrin.h>
+#define EBP_TARGET_SSE2 __attribute__((target("sse2")))
+#define EBP_TARGET_SSE41 __attribute__((target("sse4.1")))
+#define EBP_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define EBP_SIMD_X86 0
+#endif
+
+namespace easy_byte_parser {
+namespace simd {
+
+namespace {
+
+std::atomic<int> levelLimit{static_cast<int>(Level::AVX2)};
+
+Level detectLevel() {
+#if EBP_SIMD_X86
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx2")) return Level::AVX2;
+  if (__builtin_cpu_supports("sse4.1")) return Level::SSE41;
+#endif
+  return Level::Scalar;
+}
+
+#if EBP_SIMD_X86
+
+/// Per-column constants shared by the kernels.
+struct Plan {
+  size_t columnIndex = 0;  // Alternative of Column that is written
+  uint8_t shuffle[16];     // Byte swap and truncation of each 32-bit lane, or byte swap of each 64-bit lane
+  bool wide = false;       // 8-byte field, decoded in 64-bit lanes
+  bool bits = false;       // Apply shift and mask
+  int shift = 0;
+  uint64_t mask = 0;
+  int signShift = 0;           // Sign extension of narrow signed values before conversion to double
+  bool unsignedWide = false;   // 32-bit unsigned values need an unsigned conversion to double
+  bool isFloat = false;
+  bool isDouble = false;
+  bool scaled = false;
+  double scale = 1.0;
+  double bias = 0.0;
+};
+
+size_t typeWidth(FieldType type) {
+  switch (type) {
+    case FieldType::UInt16:
+    case FieldType::Int16:
+      return 2;
+    case FieldType::UInt32:
+    case FieldType::Int32:
+    case FieldType::Float:
+      return 4;
+    case FieldType::UInt64:
+    case FieldType::Int64:
+    case FieldType::Double:
+      return 8;
+    default:
+      return 1;
+  }
+}
+
+bool isSignedType(FieldType type) {
+  return type == FieldType::Int8 || type == FieldType::Int16 || type == FieldType::Int32;
+}
+
+Plan makePlan(const FieldOp& op, size_t columnIndex) {
+  Plan p;
+  const size_t width = typeWidth(op.type);
+  const size_t lanes = width == 8 ? 2 : 4;
+  const size_t laneWidth = 16 / lanes;
+  for (size_t lane = 0; lane < lanes; ++lane) {
+    for (size_t k = 0; k < laneWidth; ++k) {
+      uint8_t src = 0x80;  // pshufb zeroes the byte
+      if (k < width) src = static_cast<uint8_t>(lane * laneWidth + (op.byteSwap ? width - 1 - k : k));
+      p.shuffle[lane * laneWidth + k] = src;
+    }
+  }
+  p.columnIndex = columnIndex;
+  p.wide = width == 8;
+  p.bits = op.mask != 0;
+  p.shift = op.shift;
+  p.mask = op.mask;
+  p.isFloat = op.type == FieldType::Float;
+  p.isDouble = op.type == FieldType::Double;
+  const bool signedValue = isSignedType(op.type) && !p.bits;
+  p.signShift = signedValue ? static_cast<int>(32 - 8 * width) : 0;
+  p.unsignedWide = width == 4 && !signedValue && !p.isFloat;
+  p.scaled = op.needsScaling;
+  p.scale = op.scale;
+  p.bias = op.bias;
+  return p;
+}
+
+constexpr size_t kDoubleColumn = static_cast<size_t>(FieldType::Float);
+constexpr size_t kBitColumn = static_cast<size_t>(FieldType::Bool);
+
+// Typed pointer into the storage of a column of any kind
+void* columnData(Column& column) {
+  return std::visit(
+      [](auto& col) -> void* {
+        using C = std::decay_t<decltype(col)>;
+        if constexpr (std::is_same_v<C, BitColumn>)
+          return col.words().data();
+        else
+          return col.data();
+      },
+      column);
+}
+
+// --- AVX2: 8 frames per iteration with a hardware gather ---
+
+EBP_TARGET_AVX2 inline void storeDoublesAvx2(double* out, __m256d lo, __m256d hi, const Plan& p) {
+  if (p.scaled) {
+    // Separate multiply and add keep results bit-identical to the scalar path
+    const __m256d scale = _mm256_set1_pd(p.scale);
+    const __m256d bias = _mm256_set1_pd(p.bias);
+    lo = _mm256_add_pd(_mm256_mul_pd(lo, scale), bias);
+    hi = _mm256_add_pd(_mm256_mul_pd(hi, scale), bias);
+  }
+  _mm256_storeu_pd(out, lo);
+  _mm256_storeu_pd(out + 4, hi);
+}
+
+EBP_TARGET_AVX2 size_t decodeAvx2(const Plan& p, const char* base, size_t begin, size_t end, size_t stride,
+                                   void* out) {
+  // Gather offsets are 32-bit
+  if (stride > static_cast<size_t>(INT_MAX) / 8) return begin;
+
+  const __m256i vindex =
+      _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32(static_cast<int>(stride)));
+  const __m256i shuffle = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p.shuffle)));
+  const __m256i mask = _mm256_set1_epi32(static_cast<int>(static_cast<uint32_t>(p.mask)));
+  const __m128i shift = _mm_cvtsi32_si128(p.shift);
+  const __m128i signShift = _mm_cvtsi32_si128(p.signShift);
+  const __m256i compact16 = _mm256_setr_epi8(0, 1, 4, 5, 8, 9, 12, 13, -1, -1, -1, -1, -1, -1, -1, -1, 0, 1, 4, 5, 8,
+                                             9, 12, 13, -1, -1, -1, -1, -1, -1, -1, -1);
+  const __m256i compact8 = _mm256_setr_epi8(0, 4, 8, 12, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 4, 8, 12,
+                                            -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1);
+  const __m256i join8 = _mm256_setr_epi32(0, 4, 0, 0, 0, 0, 0, 0);
+  const __m256i signBit = _mm256_set1_epi32(INT_MIN);
+  const __m256d twoPow31 = _mm256_set1_pd(2147483648.0);
+
+  const size_t n = begin + ((end - begin) & (p.columnIndex == kBitColumn ? ~size_t(63) : ~size_t(7)));
+  const ptrdiff_t step = static_cast<ptrdiff_t>(stride * 8);
+  uint64_t word = 0;
+
+  for (size_t i = begin; i < n; i += 8, base += step) {
+    __m256i v = _mm256_i32gather_epi32(reinterpret_cast<const int*>(base), vindex, 1);
+    v = _mm256_shuffle_epi8(v, shuffle);
+    if (p.bits) v = _mm256_and_si256(_mm256_srl_epi32(v, shift), mask);
+
+    switch (p.columnIndex) {
+      case static_cast<size_t>(FieldType::UInt8):
+      case static_cast<size_t>(FieldType::Int8): {
+        __m256i packed = _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(v, compact8), join8);
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(static_cast<uint8_t*>(out) + i), _mm256_castsi256_si128(packed));
+        break;
+      }
+      case static_cast<size_t>(FieldType::UInt16):
+      case static_cast<size_t>(FieldType::Int16): {
+        __m256i packed = _mm256_permute4x64_epi64(_mm256_shuffle_epi8(v, compact16), 0x08);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(static_cast<uint16_t*>(out) + i), _mm256_castsi256_si128(packed));
+        break;
+      }
+      case static_cast<size_t>(FieldType::UInt32):
+      case static_cast<size_t>(FieldType::Int32):
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(static_cast<uint32_t*>(out) + i), v);
+        break;
+      case kDoubleColumn: {
+        __m256d lo, hi;
+        if (p.isFloat) {
+          __m256 f = _mm256_castsi256_ps(v);
+          lo = _mm256_cvtps_pd(_mm256_castps256_ps128(f));
+          hi = _mm256_cvtps_pd(_mm256_extractf128_ps(f, 1));
+        } else if (p.unsignedWide) {
+          __m256i s = _mm256_xor_si256(v, signBit);
+          lo = _mm256_add_pd(_mm256_cvtepi32_pd(_mm256_castsi256_si128(s)), twoPow31);
+          hi = _mm256_add_pd(_mm256_cvtepi32_pd(_mm256_extracti128_si256(s, 1)), twoPow31);
+        } else {
+          if (p.signShift) v = _mm256_sra_epi32(_mm256_sll_epi32(v, signShift), signShift);
+          lo = _mm256_cvtepi32_pd(_mm256_castsi256_si128(v));
+          hi = _mm256_cvtepi32_pd(_mm256_extracti128_si256(v, 1));
+        }
+        storeDoublesAvx2(static_cast<double*>(out) + i, lo, hi, p);
+        break;
+      }
+      case kBitColumn: {
+        __m256i zero = _mm256_cmpeq_epi32(v, _mm256_setzero_si256());
+        auto set = static_cast<uint64_t>(~_mm256_movemask_ps(_mm256_castsi256_ps(zero)) & 0xFF);
+        word |= set << (i & 63);
+        if ((i & 63) == 56) {
+          static_cast<uint64_t*>(out)[i >> 6] = word;
+          word = 0;
+        }
+        break;
+      }
+    }
+  }
+  return n;
+}
+
+/// 8-byte fields: 4 frames per iteration with a 64-bit gather. Writes 64-bit integer columns and
+/// doubles; 64-bit integers converted to double need AVX-512 and are left to the caller.
+EBP_TARGET_AVX2 size_t decodeWideAvx2(const Plan& p, const char* base, size_t begin, size_t end, size_t stride,
+                                       void* out) {
+  if (stride > static_cast<size_t>(INT_MAX) / 4) return begin;
+
+  const __m128i vindex = _mm_mullo_epi32(_mm_setr_epi32(0, 1, 2, 3), _mm_set1_epi32(static_cast<int>(stride)));
+  const __m256i shuffle = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p.shuffle)));
+  const __m256i mask = _mm256_set1_epi64x(static_cast<long long>(p.mask));
+  const __m128i shift = _mm_cvtsi32_si128(p.shift);
+
+  const size_t n = begin + ((end - begin) & ~size_t(3));
+  const ptrdiff_t step = static_cast<ptrdiff_t>(stride * 4);
+  for (size_t i = begin; i < n; i += 4, base += step) {
+    __m256i v = _mm256_i32gather_epi64(reinterpret_cast<const long long*>(base), vindex, 1);
+    v = _mm256_shuffle_epi8(v, shuffle);
+    if (p.bits) v = _mm256_and_si256(_mm256_srl_epi64(v, shift), mask);
+    if (p.columnIndex == kDoubleColumn) {
+      __m256d d = _mm256_castsi256_pd(v);
+      if (p.scaled) d = _mm256_add_pd(_mm256_mul_pd(d, _mm256_set1_pd(p.scale)), _mm256_set1_pd(p.bias));
+      _mm256_storeu_pd(static_cast<double*>(out) + i, d);
+    } else {
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(static_cast<uint64_t*>(out) + i), v);
+    }
+  }
+  return n;
+}
+
+// --- SSE4.1: 4 frames per iteration, gather emulated with scalar loads ---
+
+EBP_TARGET_SSE41 inline int load32(const char* ptr) {
+  int value;
+  std::memcpy(&value, ptr, 4);
+  return value;
+}
+
+EBP_TARGET_SSE41 inline __m128i gatherSse(const char* base, size_t stride) {
+  __m128i v = _mm_cvtsi32_si128(load32(base));
+  v = _mm_insert_epi32(v, load32(base + stride), 1);
+  v = _mm_insert_epi32(v, load32(base + 2 * stride), 2);
+  return _mm_insert_epi32(v, load32(base + 3 * stride), 3);
+}
+
+/// 8-byte fields: 2 frames per iteration, see decodeWideAvx2().
+EBP_TARGET_SSE41 size_t decodeWideSse41(const Plan& p, const char* base, size_t begin, size_t end, size_t stride,
+                                        void* out) {
+  const __m128i shuffle = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p.shuffle));
+  const __m128i mask = _mm_set1_epi64x(static_cast<long long>(p.mask));
+  const __m128i shift = _mm_cvtsi32_si128(p.shift);
+  const __m128d scale = _mm_set1_pd(p.scale);
+  const __m128d bias = _mm_set1_pd(p.bias);
+
+  const size_t n = begin + ((end - begin) & ~size_t(1));
+  for (size_t i = begin; i < n; i += 2, base += stride * 2) {
+    long long lo, hi;
+    std::memcpy(&lo, base, 8);
+    std::memcpy(&hi, base + stride, 8);
+    __m128i v = _mm_shuffle_epi8(_mm_set_epi64x(hi, lo), shuffle);
+    if (p.bits) v = _mm_and_si128(_mm_srl_epi64(v, shift), mask);
+    if (p.columnIndex == kDoubleColumn) {
+      __m128d d = _mm_castsi128_pd(v);
+      if (p.scaled) d = _mm_add_pd(_mm_mul_pd(d, scale), bias);
+      _mm_storeu_pd(static_cast<double*>(out) + i, d);
+    } else {
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(static_cast<uint64_t*>(out) + i), v);
+    }
+  }
+  return n;
+}
+
+EBP_TARGET_SSE41 size_t decodeSse41(const Plan& p, const char* base, size_t begin, size_t end, size_t stride,
+                                    void* out) {
+  const __m128i shuffle = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p.shuffle));
+  const __m128i mask = _mm_set1_epi32(static_cast<int>(static_cast<uint32_t>(p.mask)));
+  const __m128i shift = _mm_cvtsi32_si128(p.shift);
+  const __m128i signShift = _mm_cvtsi32_si128(p.signShift);
+  const __m128i compact16 = _mm_setr_epi8(0, 1, 4, 5, 8, 9, 12, 13, -1, -1, -1, -1, -1, -1, -1, -1);
+  const __m128i compact8 = _mm_setr_epi8(0, 4, 8, 12, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1);
+  const __m128i signBit = _mm_set1_epi32(INT_MIN);
+  const __m128d twoPow31 = _mm_set1_pd(2147483648.0);
+  const __m128d scale = _mm_set1_pd(p.scale);
+  const __m128d bias = _mm_set1_pd(p.bias);
+
+  const size_t n = begin + ((end - begin) & (p.columnIndex == kBitColumn ? ~size_t(63) : ~size_t(3)));
+  uint64_t word = 0;
+
+  for (size_t i = begin; i < n; i += 4, base += stride * 4) {
+    __m128i v = _mm_shuffle_epi8(gatherSse(base, stride), shuffle);
+    if (p.bits) v = _mm_and_si128(_mm_srl_epi32(v, shift), mask);
+
+    switch (p.columnIndex) {
+      case static_cast<size_t>(FieldType::UInt8):
+      case static_cast<size_t>(FieldType::Int8): {
+        int packed = _mm_cvtsi128_si32(_mm_shuffle_epi8(v, compact8));
+        std::memcpy(static_cast<uint8_t*>(out) + i, &packed, 4);
+        break;
+      }
+      case static_cast<size_t>(FieldType::UInt16):
+      case static_cast<size_t>(FieldType::Int16):
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(static_cast<uint16_t*>(out) + i), _mm_shuffle_epi8(v, compact16));
+        break;
+      case static_cast<size_t>(FieldType::UInt32):
+      case static_cast<size_t>(FieldType::Int32):
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(static_cast<uint32_t*>(out) + i), v);
+        break;
+      case kDoubleColumn: {
+        __m128d lo, hi;
+        if (p.isFloat) {
+          __m128 f = _mm_castsi128_ps(v);
+          lo = _mm_cvtps_pd(f);
+          hi = _mm_cvtps_pd(_mm_movehl_ps(f, f));
+        } else if (p.unsignedWide) {
+          __m128i s = _mm_xor_si128(v, signBit);
+          lo = _mm_add_pd(_mm_cvtepi32_pd(s), twoPow31);
+          hi = _mm_add_pd(_mm_cvtepi32_pd(_mm_srli_si128(s, 8)), twoPow31);
+        } else {
+          if (p.signShift) v = _mm_sra_epi32(_mm_sll_epi32(v, signShift), signShift);
+          lo = _mm_cvtepi32_pd(v);
+          hi = _mm_cvtepi32_pd(_mm_srli_si128(v, 8));
+        }
+        if (p.scaled) {
+          lo = _mm_add_pd(_mm_mul_pd(lo, scale), bias);
+          hi = _mm_add_pd(_mm_mul_pd(hi, scale), bias);
+        }
+        double* dst = static_cast<double*>(out) + i;
+        _mm_storeu_pd(dst, lo);
+        _mm_storeu_pd(dst + 2, hi);
+        break;
+      }
+      case kBitColumn: {
+        __m128i zero = _mm_cmpeq_epi32(v, _mm_setzero_si128());
+        auto set = static_cast<uint64_t>(~_mm_movemask_ps(_mm_castsi128_ps(zero)) & 0xF);
+        word |= set << (i & 63);
+        if ((i & 63) == 60) {
+          static_cast<uint64_t*>(out)[i >> 6] = word;
+          word = 0;
+        }
+        break;
+      }
+    }
+  }
+  return n;
+}
+
+/// Start code search: candidates must match the first and the last start code byte, which
+/// rejects almost all positions of random data; the bytes in between are compared per candidate.
+/// Returns the first candidate that matches completely, or the first position not examined
+/// because its last start code byte lies beyond the last full block.
+EBP_TARGET_AVX2 size_t findStartAvx2(const char* data, size_t size, const uint8_t* code, size_t length) {
+  const __m256i first = _mm256_set1_epi8(static_cast<char>(code[0]));
+  const __m256i last = _mm256_set1_epi8(static_cast<char>(code[length - 1]));
+  size_t i = 0;
+  for (; i + length - 1 + 32 <= size; i += 32) {
+    __m256i a = _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i)), first);
+    __m256i b = _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i + length - 1)), last);
+    auto mask = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_and_si256(a, b)));
+    while (mask) {
+      size_t pos = i + static_cast<size_t>(__builtin_ctz(mask));
+      if (length <= 2 || std::memcmp(data + pos + 1, code + 1, length - 2) == 0) return pos;
+      mask &= mask - 1;
+    }
+  }
+  return i;
+}
+
+EBP_TARGET_SSE2 size_t findStartSse2(const char* data, size_t size, const uint8_t* code, size_t length) {
+  const __m128i first = _mm_set1_epi8(static_cast<char>(code[0]));
+  const __m128i last = _mm_set1_epi8(static_cast<char>(code[length - 1]));
+  size_t i = 0;
+  for (; i + length - 1 + 16 <= size; i += 16) {
+    __m128i a = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i)), first);
+    __m128i b = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i + length - 1)), last);
+    auto mask = static_cast<uint32_t>(_mm_movemask_epi8(_mm_and_si128(a, b)));
+    while (mask) {
+      size_t pos = i + static_cast<size_t>(__builtin_ctz(mask));
+      if (length <= 2 || std::memcmp(data + pos + 1, code + 1, length - 2) == 0) return pos;
+      mask &= mask - 1;
+    }
+  }
+  return i;
+}
+
+#endif  // EBP_SIMD_X86
+
+}  // namespace
+
+Level supportedLevel() {
+  static const Level level = detectLevel();
+  return level;
+}
+
+Level activeLevel() {
+  return std::min(supportedLevel(), static_cast<Level>(levelLimit.load(std::memory_order_relaxed)));
+}
+
+void setLevelLimit(Level level) {
+  levelLimit.store(static_cast<int>(level), std::memory_order_relaxed);
+}
+
+size_t decodeColumn(const FieldOp& op, const char* data, size_t begin, size_t end, size_t stride, Column& column) {
+#if EBP_SIMD_X86
+  const Level level = activeLevel();
+  if (level == Level::Scalar || begin >= end) return begin;
+
+  const Plan plan = makePlan(op, column.index());
+  const char* base = data + begin * stride + op.byteOffset;
+  void* out = columnData(column);
+  if (plan.wide) {
+    if (plan.columnIndex == kDoubleColumn && !plan.isDouble) return begin;  // Scaled 64-bit integers
+    if (level == Level::AVX2) return decodeWideAvx2(plan, base, begin, end, stride, out);
+    return decodeWideSse41(plan, base, begin, end, stride, out);
+  }
+  if (level == Level::AVX2) return decodeAvx2(plan, base, begin, end, stride, out);
+  return decodeSse41(plan, base, begin, end, stride, out);
+#else
+  (void)op;
+  (void)data;
+  (void)end;
+  (void)stride;
+  (void)column;
+  return begin;
+#endif
+}
+
+size_t findStartCode(const char* data, size_t size, const uint8_t* code, size_t codeLength) {
+  if (codeLength == 0) return 0;
+  size_t pos = 0;
+#if EBP_SIMD_X86
+  const Level level = activeLevel();
+  if (level == Level::AVX2) {
+    pos = findStartAvx2(data, size, code, codeLength);
+  } else if (level == Level::SSE41) {
+    pos = findStartSse2(data, size, code, codeLength);
+  }
+#endif
+  // Confirms a match found by the kernels, or searches the tail and cut-off candidates
+  return pos + utils::findStartCode(data + pos, size - pos, code, codeLength);
+}
+
+}  // namespace simd
+}  // namespace easy_byte_parser
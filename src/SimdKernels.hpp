@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "EasyByteParserCpp/ByteParser.hpp"
+
+namespace easy_byte_parser {
+namespace simd {
+
+/// Instruction set levels with dedicated kernels, ordered by capability.
+enum class Level { Scalar, SSE41, AVX2 };
+
+/// Best level supported by the running CPU, detected once.
+Level supportedLevel();
+
+/// Level used for dispatch: supportedLevel() capped by setLevelLimit().
+Level activeLevel();
+
+/// Cap the dispatch level, e.g. to compare kernels in tests and benchmarks.
+void setLevelLimit(Level level);
+
+/// Decode a leading run of the frames [begin, end) of one column with the active kernel.
+/// Each field is fetched with a 4-byte load, so the caller only passes frames for
+/// which reading 4 bytes at the field offset stays inside the buffer. 8-byte fields
+/// are fetched whole. Scaled 64-bit integers are left to the caller.
+/// \param op Field to extract
+/// \param data Pointer to frame 0 of the batch
+/// \param begin First frame to decode, a multiple of 64 for bool columns
+/// \param end One past the last frame safe to read with a 4-byte load
+/// \param stride Distance in bytes between the starts of consecutive frames
+/// \param column Output column, already sized for at least \p end frames
+/// \return First frame not decoded, the caller decodes the remaining ones
+size_t decodeColumn(const FieldOp& op, const char* data, size_t begin, size_t end, size_t stride, Column& column);
+
+/// Find the first position where a start code begins, with the active kernel.
+/// Same result as utils::findStartCode(): a candidate cut off by the end of the
+/// buffer also counts. The SSE4.1 level uses an SSE2 kernel.
+/// \param data Pointer to data buffer
+/// \param size Size of data buffer
+/// \param code Start code bytes, an empty code matches at 0
+/// \param codeLength Number of start code bytes
+/// \return Position of the first full or cut-off match, size if there is none
+size_t findStartCode(const char* data, size_t size, const uint8_t* code, size_t codeLength);
+
+}  // namespace simd
+}  // namespace easy_byte_parser
@@ -0,0 +1,165 @@
+#include "EasyByteParserCpp/StreamFramer.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+#include "SimdKernels.hpp"
+
+namespace easy_byte_parser {
+
+void StreamFramer::feed(const char* data, size_t size, const FrameCallback& onFrame) {
+  parser_.compile();
+  scan(data, size, [&](const char* frame) { deliver(frame, onFrame); });
+}
+
+void StreamFramer::feed(const char* data, size_t size, BatchResult& batch) {
+  parser_.compile();
+  beginCollect();
+  scan(data, size, [&](const char* frame) { collect(frame); });
+  endCollect(batch);
+}
+
+void StreamFramer::feed(RingBuffer& ring, const FrameCallback& onFrame) {
+  parser_.compile();
+  scanRing(ring, [&](const char* frame) { deliver(frame, onFrame); });
+}
+
+void StreamFramer::feed(RingBuffer& ring, BatchResult& batch) {
+  parser_.compile();
+  beginCollect();
+  scanRing(ring, [&](const char* frame) { collect(frame); });
+  endCollect(batch);
+}
+
+void StreamFramer::deliver(const char* frame, const FrameCallback& onFrame) {
+  parser_.decodeFrame(frame, result_);
+  ++stats_.frames;
+  onFrame(result_);
+}
+
+void StreamFramer::beginCollect() {
+  frames_.clear();
+  spill_.clear();
+  spilled_.clear();
+}
+
+void StreamFramer::collect(const char* frame) {
+  // complete_ is reused by the next frame completed from carry_, keep a copy
+  if (frame == complete_.data()) {
+    spilled_.push_back(frames_.size());
+    spill_.insert(spill_.end(), complete_.begin(), complete_.end());
+    frame = nullptr;
+  }
+  frames_.push_back(frame);
+}
+
+void StreamFramer::endCollect(BatchResult& batch) {
+  const size_t totalLength = parser_.getTotalLength();
+  for (size_t i = 0; i < spilled_.size(); ++i) frames_[spilled_[i]] = spill_.data() + i * totalLength;
+  parser_.decodeFrames(frames_.data(), frames_.size(), batch);
+  stats_.frames += frames_.size();
+}
+
+void StreamFramer::reset() {
+  carry_.clear();
+  stats_ = StreamStats();
+}
+
+FrameStatus StreamFramer::classify(const char* frame) {
+  FrameStatus status = parser_.checkFrame(frame);
+  // A filtered candidate is skipped as a whole only if it really is a frame. Filtered implies a
+  // matching StartCode, so only the CRC is left to check.
+  if (status == FrameStatus::Filtered) {
+    FrameStatus integrity = parser_.checkCrc(frame);
+    if (integrity != FrameStatus::Ok) status = integrity;
+  }
+  if (status == FrameStatus::CrcMismatch) ++stats_.crcErrors;
+  if (status == FrameStatus::Filtered) ++stats_.filtered;
+  return status;
+}
+
+template <typename Emit>
+void StreamFramer::scan(const char* data, size_t size, Emit&& emit) {
+  const size_t totalLength = parser_.getTotalLength();
+  const std::vector<uint8_t>& code = parser_.getStartCode();
+
+  // Complete the frame started in a previous chunk
+  while (!carry_.empty()) {
+    size_t take = std::min(totalLength - carry_.size(), size);
+    carry_.insert(carry_.end(), data, data + take);
+    data += take;
+    size -= take;
+
+    bool candidate =
+        code.empty() || std::memcmp(carry_.data(), code.data(), std::min(carry_.size(), code.size())) == 0;
+    if (candidate && carry_.size() < totalLength) return;  // Chunk exhausted
+    const FrameStatus status = candidate ? classify(carry_.data()) : FrameStatus::InvalidStartCode;
+    if (status == FrameStatus::Ok) {
+      complete_.swap(carry_);
+      carry_.clear();
+      emit(complete_.data());
+      break;
+    }
+    if (status == FrameStatus::Filtered) {
+      carry_.clear();
+      break;
+    }
+    // Search again after the rejected StartCode. The rest is shorter than a frame, so at most
+    // a new partial frame is carried and nothing is emitted from complete_, used as scratch here.
+    ++stats_.discardedBytes;
+    complete_.assign(carry_.begin() + 1, carry_.end());
+    carry_.clear();
+    size_t rest = scanChunk(complete_.data(), complete_.size(), emit);
+    carry_.assign(complete_.begin() + rest, complete_.end());
+  }
+  size_t rest = scanChunk(data, size, emit);
+  carry_.assign(data + rest, data + size);
+}
+
+template <typename Emit>
+void StreamFramer::scanRing(RingBuffer& ring, Emit&& emit) {
+  if (!ring.mirrored() && ring.slack() < parser_.getTotalLength()) {
+    throw std::invalid_argument("[EasyByteParserCpp]: RingBuffer slack is shorter than TotalLength");
+  }
+  while (ring.readable() > 0) {
+    const size_t size = ring.readableContiguous();
+    if (!carry_.empty()) {
+      // Left over from feeding chunks, completed through the copying path
+      scan(ring.readPtr(), size, emit);
+      ring.consume(size);
+      continue;
+    }
+    // A partial frame stays in the ring. If the view was cut short by the slack, the partial
+    // frame starts behind the end of the buffer and the next view begins there.
+    const bool whole = size == ring.readable();
+    ring.consume(scanChunk(ring.readPtr(), size, emit));
+    if (whole) break;
+  }
+}
+
+template <typename Emit>
+size_t StreamFramer::scanChunk(const char* data, size_t size, Emit&& emit) {
+  const size_t totalLength = parser_.getTotalLength();
+  const std::vector<uint8_t>& code = parser_.getStartCode();
+
+  size_t pos = 0;
+  while (true) {
+    size_t hit = pos + simd::findStartCode(data + pos, size - pos, code.data(), code.size());
+    stats_.discardedBytes += hit - pos;
+    pos = hit;
+    if (pos == size || size - pos < totalLength) return pos;
+    const FrameStatus status = classify(data + pos);
+    if (status == FrameStatus::Ok) {
+      emit(data + pos);
+      pos += totalLength;
+    } else if (status == FrameStatus::Filtered) {
+      pos += totalLength;
+    } else {
+      ++stats_.discardedBytes;
+      ++pos;
+    }
+  }
+}
+
+}  // namespace easy_byte_parser
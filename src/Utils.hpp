@@ -8,6 +8,8 @@
 #include <type_traits>
 #include <vector>
 
+#include "CrcEngine.hpp"
+
 namespace easy_byte_parser {
 namespace utils {
 
@@ -81,11 +83,48 @@ T readFromBuffer(const char *data, bool isBigEndianSource) {
   return value;
 }
 
-/// Calculate CRC16-MODBUS
+/// Read a value, reversing its bytes when requested
+/// \param data Source data pointer
+/// \param swap True if the byte order must be reversed
+/// \return Read value
+template <typename T> inline T readSwapped(const char *data, bool swap) {
+  T value;
+  std::memcpy(&value, data, sizeof(T));
+  return swap ? byteswap(value) : value;
+}
+
+/// Find the first position where a start code begins.
+/// A candidate cut off by the end of the buffer also counts, so that callers
+/// can keep it until more data arrives.
+/// \param data Pointer to data buffer
+/// \param size Size of data buffer
+/// \param code Start code bytes, an empty code matches at 0
+/// \param codeLength Number of start code bytes
+/// \return Position of the first full or cut-off match, size if there is none
+inline size_t findStartCode(const char *data, size_t size, const uint8_t *code,
+                            size_t codeLength) {
+  if (codeLength == 0)
+    return 0;
+  size_t pos = 0;
+  while (pos < size) {
+    const void *hit = std::memchr(data + pos, code[0], size - pos);
+    if (!hit)
+      return size;
+    pos = static_cast<const char *>(hit) - data;
+    size_t n = std::min(codeLength, size - pos);
+    if (std::memcmp(data + pos, code, n) == 0)
+      return pos;
+    ++pos;
+  }
+  return size;
+}
+
+/// Calculate CRC16-MODBUS one bit at a time. Reference implementation.
 /// \param data Pointer to data buffer
 /// \param length Length of data
 /// \return CRC16 value (little-endian)
-inline uint16_t calculateCRC16Modbus(const uint8_t *data, size_t length) {
+inline uint16_t calculateCRC16ModbusBitwise(const uint8_t *data,
+                                            size_t length) {
   uint16_t crc = 0xFFFF;
 
   for (size_t i = 0; i < length; i++) {
@@ -102,5 +141,14 @@ inline uint16_t calculateCRC16Modbus(const uint8_t *data, size_t length) {
   return crc;
 }
 
+/// Calculate CRC16-MODBUS with the shared engine (slicing-by-8 tables,
+/// PCLMULQDQ folding for long inputs)
+/// \param data Pointer to data buffer
+/// \param length Length of data
+/// \return CRC16 value (little-endian)
+inline uint16_t calculateCRC16Modbus(const uint8_t *data, size_t length) {
+  return static_cast<uint16_t>(crc16ModbusEngine().compute(data, length));
+}
+
 } // namespace utils
 } // namespace easy_byte_parser
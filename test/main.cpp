@@ -1,14 +1,53 @@
+#include <atomic>
 #include <cassert>
 #include <cmath>
+#include <cstdio>
+#include <cstdlib>
 #include <cstring>
+#include <fstream>
 #include <iostream>
+#include <new>
 #include <thread>
 #include <vector>
 
+#include "CrcEngine.hpp"
 #include "EasyByteParserCpp/ByteParser.hpp"
+#include "EasyByteParserCpp/Pipeline.hpp"
+#include "EasyByteParserCpp/RingBuffer.hpp"
+#include "EasyByteParserCpp/Schema.hpp"
+#include "EasyByteParserCpp/StreamFramer.hpp"
+#include "EasyByteParserCpp/WorkerPool.hpp"
+#include "SimdKernels.hpp"
+#include "Utils.hpp"
+#ifdef EBP_TEST_CODEGEN
+#include "test_config.hpp"       // Generated by ebp_codegen from test_config.ini
+#include "test_config_wide.hpp"  // Generated by ebp_codegen from test_config_wide.ini
+#include "test_config_names.hpp"  // Generated by ebp_codegen from test_config_names.ini
+#endif
 
 using namespace easy_byte_parser;
 
+// Global allocation counter used to verify allocation-free hot paths
+static std::atomic<size_t> g_allocations{0};
+
+void *operator new(size_t size) {
+  ++g_allocations;
+  if (void *p = std::malloc(size ? size : 1)) return p;
+  throw std::bad_alloc();
+}
+
+// Both replaced operators use malloc/free, GCC still flags free() once inlined into new-expressions
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 11
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+void operator delete(void *p) noexcept { std::free(p); }
+
+void operator delete(void *p, size_t) noexcept { std::free(p); }
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 11
+#pragma GCC diagnostic pop
+#endif
+
 // Helper CRC for test (Modbus)
 uint16_t calcCRC(const std::vector<char> &data, size_t len) {
   uint16_t crc = 0xFFFF;
@@ -137,10 +176,67 @@ void test_parsing() {
   std::cout << "test_parsing PASSED" << std::endl;
 }
 
+ByteParser makeMixedParser();
+std::vector<char> makeMixedFrames(size_t count, size_t stride, unsigned seed);
+
+// Many threads parse through one shared const parser, each checking against a single-threaded reference
 void test_threads() {
   std::cout << "Running test_threads..." << std::endl;
-  std::thread t([]() { std::cout << "Hello from thread" << std::endl; });
-  t.join();
+  ByteParser configured = makeMixedParser();
+  configured.compile();
+  const ByteParser &parser = configured;
+
+  const size_t count = 2000;
+  const size_t frameLength = parser.getTotalLength();
+  auto data = makeMixedFrames(count, frameLength, 16);
+  for (size_t i = 0; i < count; i += 101) data[i * frameLength + 6] ^= 0x01;  // CRC failures
+  BatchResult reference;
+  parser.parseBatch(data.data(), count, frameLength, reference);
+
+  std::atomic<size_t> failures{0};
+  std::vector<std::thread> threads;
+  for (size_t t = 0; t < 8; ++t) {
+    threads.emplace_back([&, t]() {
+      ParseResult result;
+      BatchResult batch;
+      for (int round = 0; round < 5; ++round) {
+        for (size_t i = t; i < count; i += 3) {
+          const char *frame = data.data() + i * frameLength;
+          if (reference.status(i) != FrameStatus::Ok) {
+            try {
+              parser.parse(frame, frameLength, result);
+              ++failures;
+            } catch (const std::runtime_error &) {
+            }
+            continue;
+          }
+          parser.parse(frame, frameLength, result);
+          for (size_t f = 0; f < result.size(); ++f) {
+            // Compared as text, random float bits include NaNs
+            if (result[f].toString() != reference.value(i, f).toString()) ++failures;
+          }
+        }
+        parser.parseBatch(data.data(), count, frameLength, batch);
+        if (batch.statuses() != reference.statuses() || batch.okCount() != reference.okCount()) ++failures;
+      }
+    });
+  }
+  for (auto &thread : threads) thread.join();
+  if (failures != 0) {
+    std::cerr << "Concurrent const parse produced " << failures << " wrong results" << std::endl;
+    std::exit(1);
+  }
+
+  // The const path refuses a configuration changed after compile()
+  configured.setTotalLength(frameLength);
+  try {
+    ParseResult result;
+    parser.parse(data.data(), frameLength, result);
+    std::cerr << "Const parse should throw after a configuration change" << std::endl;
+    std::exit(1);
+  } catch (const std::runtime_error &) {
+  }
+  std::cout << "test_threads PASSED" << std::endl;
 }
 
 void test_invalid_config() {
@@ -744,6 +840,1789 @@ void test_programmatic_ini_equivalents() {
   std::cout << p.getConfigurationChecklist() << std::endl;
 }
 
+void test_compiled_layout() {
+  std::cout << "Running test_compiled_layout..." << std::endl;
+  ByteParser parser;
+  parser.setTotalLength(8)
+      .addField<int16_t>("scaled", 0, 0, 0, false, 0.5, -1.0)  // Little Endian
+      .addField<int8_t>("bits", 2, 4, 4)
+      .addField<bool>("flag", 3, 7, 1)
+      .addField<int32_t>("signed", 4);
+
+  const CompiledLayout &layout = parser.compile();
+  if (layout.ops.size() != 4 || layout.names[1] != "bits") {
+    std::cerr << "Compiled layout has wrong shape" << std::endl;
+    std::exit(1);
+  }
+  if (layout.ops[0].type != FieldType::Int16 || !layout.ops[0].needsScaling || layout.ops[1].mask != 0xF ||
+      layout.ops[1].shift != 4 || layout.ops[2].mask != 1 || layout.ops[3].needsScaling) {
+    std::cerr << "Compiled layout has wrong ops" << std::endl;
+    std::exit(1);
+  }
+
+  std::vector<char> buf(8, 0);
+  buf[0] = (char)0xF6;  // -10 little endian -> -10 * 0.5 - 1 = -6
+  buf[1] = (char)0xFF;
+  buf[2] = (char)0xA5;  // high nibble 0xA
+  buf[3] = (char)0x80;
+  buf[4] = (char)0xFF;  // -2 big endian
+  buf[5] = (char)0xFF;
+  buf[6] = (char)0xFF;
+  buf[7] = (char)0xFE;
+
+  auto res = parser.parse(buf);
+  if (std::abs(std::get<double>(res["scaled"].getValue()) + 6.0) > 1e-9 ||
+      std::get<uint64_t>(res["bits"].getValue()) != 0xA || std::get<bool>(res["flag"].getValue()) != true ||
+      std::get<int64_t>(res["signed"].getValue()) != -2) {
+    std::cerr << "Compiled layout decode failed: " << ByteParser::dumpRaw(res) << std::endl;
+    std::exit(1);
+  }
+  std::cout << "test_compiled_layout PASSED" << std::endl;
+}
+
+void test_config_revalidation() {
+  std::cout << "Running test_config_revalidation..." << std::endl;
+  ByteParser parser;
+  parser.setTotalLength(4).addField<uint8_t>("a", 0);
+
+  std::vector<char> buf = {1, 2, 3, 4};
+  if (parser.parse(buf).size() != 1) {
+    std::cerr << "Initial parse failed" << std::endl;
+    std::exit(1);
+  }
+
+  // Valid change after a parse must be picked up
+  parser.addField<uint8_t>("b", 1);
+  auto res = parser.parse(buf);
+  if (res.size() != 2 || std::get<uint64_t>(res["b"].getValue()) != 2) {
+    std::cerr << "Added field not picked up after re-configuration" << std::endl;
+    std::exit(1);
+  }
+
+  // Invalid change after a parse must be rejected on the next parse
+  parser.addField<uint8_t>("overlap", 1);
+  bool caught = false;
+  try {
+    parser.parse(buf);
+  } catch (const std::exception &e) {
+    if (std::string(e.what()).find("Overlap detected") != std::string::npos) caught = true;
+  }
+  if (!caught) {
+    std::cerr << "Invalid re-configuration not detected by parse" << std::endl;
+    std::exit(1);
+  }
+
+  parser.clear();
+  parser.setTotalLength(2).addField<uint16_t>("c", 0);
+  if (std::get<uint64_t>(parser.parse(buf)["c"].getValue()) != 0x0102) {
+    std::cerr << "Parse after clear() failed" << std::endl;
+    std::exit(1);
+  }
+  std::cout << "test_config_revalidation PASSED" << std::endl;
+}
+
+void test_parse_result() {
+  std::cout << "Running test_parse_result..." << std::endl;
+  ByteParser parser;
+  parser.loadConfig("test_config.ini");
+
+  std::vector<char> buf(20, 0);
+  buf[0] = 0x02;
+  buf[1] = 0x03;
+  buf[11] = 0x0B;
+  auto fillCRC = [&buf]() {
+    uint16_t crc = calcCRC(buf, 18);
+    buf[18] = crc & 0xFF;
+    buf[19] = (crc >> 8) & 0xFF;
+  };
+
+  ParseResult result;
+  buf[2] = 10;
+  fillCRC();
+  parser.parse(buf.data(), buf.size(), result);
+  if (result.size() != 6 || result.nameAt(0) != "test.uint8_val" ||
+      std::get<uint64_t>(result.at("test.uint8_val").getValue()) != 10) {
+    std::cerr << "ParseResult first parse failed" << std::endl;
+    std::exit(1);
+  }
+
+  // Second parse overwrites in place without allocating
+  buf[2] = 20;
+  fillCRC();
+  size_t before = g_allocations;
+  parser.parse(buf.data(), buf.size(), result);
+  size_t allocations = g_allocations - before;
+  if (allocations != 0) {
+    std::cerr << "ParseResult re-parse allocated " << allocations << " times" << std::endl;
+    std::exit(1);
+  }
+  if (std::get<uint64_t>(result[0].getValue()) != 20 || std::get<uint64_t>(result.at("bit.mode").getValue()) != 5) {
+    std::cerr << "ParseResult re-parse values wrong" << std::endl;
+    std::exit(1);
+  }
+
+  // Same content as the map API
+  if (ByteParser::dumpJson(result) != ByteParser::dumpJson(parser.parse(buf))) {
+    std::cerr << "ParseResult differs from map result" << std::endl;
+    std::exit(1);
+  }
+
+  bool caught = false;
+  try {
+    (void)result.at("missing");
+  } catch (const std::out_of_range &) {
+    caught = true;
+  }
+  if (!caught) {
+    std::cerr << "ParseResult::at did not throw for a missing field" << std::endl;
+    std::exit(1);
+  }
+
+  // A layout change resizes the result
+  ByteParser small;
+  small.setTotalLength(1).addField<uint8_t>("v", 0);
+  small.parse(buf.data(), 1, result);
+  if (result.size() != 1 || std::get<uint64_t>(result.at("v").getValue()) != 2) {
+    std::cerr << "ParseResult not resized for a new layout" << std::endl;
+    std::exit(1);
+  }
+  std::cout << "test_parse_result PASSED" << std::endl;
+}
+
+void test_field_handles() {
+  std::cout << "Running test_field_handles..." << std::endl;
+  ByteParser parser;
+  parser.loadConfig("test_config.ini");
+
+  auto hU8 = parser.fieldHandle<uint64_t>("test.uint8_val");
+  auto hFloat = parser.fieldHandle<double>("test.float_val");
+  auto hMode = parser.fieldHandle<uint64_t>("bit.mode");
+
+  std::vector<char> buf(20, 0);
+  buf[0] = 0x02;
+  buf[1] = 0x03;
+  buf[2] = 10;
+  uint32_t f_int = 0x3F800000;  // 1.0 -> 1.0 * 2.0 + 1.5 = 3.5
+  buf[7] = (f_int >> 24) & 0xFF;
+  buf[8] = (f_int >> 16) & 0xFF;
+  buf[9] = (f_int >> 8) & 0xFF;
+  buf[10] = f_int & 0xFF;
+  buf[11] = 0x0B;
+  uint16_t crc = calcCRC(buf, 18);
+  buf[18] = crc & 0xFF;
+  buf[19] = (crc >> 8) & 0xFF;
+
+  ParseResult result;
+  parser.parse(buf.data(), buf.size(), result);
+  if (result.get(hU8) != 10 || std::abs(result.get(hFloat) - 3.5) > 0.0001 || result.get(hMode) != 5) {
+    std::cerr << "Field handle access failed" << std::endl;
+    std::exit(1);
+  }
+
+  // A compiled parser shared through a const reference resolves handles and transforms
+  const ByteParser &shared = parser;
+  if (shared.fieldHandle<double>("test.float_val").index() != hFloat.index() ||
+      shared.affine("test.float_val").scale != 2.0 || shared.affine("test.float_val").bias != 1.5) {
+    std::cerr << "Const handle or affine resolution failed" << std::endl;
+    std::exit(1);
+  }
+  ByteParser changed = parser;
+  changed.addField<uint8_t>("extra", 12);
+  bool caughtStale = false;
+  try {
+    (void)std::as_const(changed).fieldHandle<uint64_t>("extra");
+  } catch (const std::exception &e) {
+    if (std::string(e.what()).find("Configuration changed") != std::string::npos) caughtStale = true;
+  }
+  if (!caughtStale || changed.fieldHandle<uint64_t>("extra").index() != 6) {
+    std::cerr << "Const handle resolution on a changed parser not reported" << std::endl;
+    std::exit(1);
+  }
+
+  // Type and name mismatches are reported when the handle is resolved
+  bool caughtType = false;
+  try {
+    parser.fieldHandle<int64_t>("test.float_val");
+  } catch (const std::exception &e) {
+    if (std::string(e.what()).find("parsed as double") != std::string::npos) caughtType = true;
+  }
+  bool caughtName = false;
+  try {
+    parser.fieldHandle<double>("missing");
+  } catch (const std::exception &e) {
+    if (std::string(e.what()).find("No such field") != std::string::npos) caughtName = true;
+  }
+  if (!caughtType || !caughtName) {
+    std::cerr << "Field handle resolution errors not reported" << std::endl;
+    std::exit(1);
+  }
+  std::cout << "test_field_handles PASSED" << std::endl;
+}
+
+// Build a valid frame for test_config.ini with the given uint8 value
+std::vector<char> makeConfigFrame(uint8_t value) {
+  std::vector<char> buf(20, 0);
+  buf[0] = 0x02;
+  buf[1] = 0x03;
+  buf[2] = (char)value;
+  buf[11] = 0x0B;
+  uint16_t crc = calcCRC(buf, 18);
+  buf[18] = crc & 0xFF;
+  buf[19] = (crc >> 8) & 0xFF;
+  return buf;
+}
+
+void test_parse_batch() {
+  std::cout << "Running test_parse_batch..." << std::endl;
+  ByteParser parser;
+  parser.loadConfig("test_config.ini");
+  auto hU8 = parser.fieldHandle<uint64_t>("test.uint8_val");
+
+  // 5 frames with 4 padding bytes between them
+  const size_t stride = 24;
+  const size_t count = 5;
+  std::vector<char> data(stride * count, 0);
+  for (size_t i = 0; i < count; ++i) {
+    auto frame = makeConfigFrame((uint8_t)(i + 1));
+    std::copy(frame.begin(), frame.end(), data.begin() + i * stride);
+  }
+  data[1 * stride] = 0x7F;        // Frame 1: bad start code
+  data[3 * stride + 18] ^= 0x55;  // Frame 3: bad CRC
+
+  BatchResult batch;
+  parser.parseBatch(data.data(), count, stride, batch);
+
+  const FrameStatus expected[] = {FrameStatus::Ok, FrameStatus::InvalidStartCode, FrameStatus::Ok,
+                                  FrameStatus::CrcMismatch, FrameStatus::Ok};
+  for (size_t i = 0; i < count; ++i) {
+    if (batch.status(i) != expected[i]) {
+      std::cerr << "Batch frame " << i << " has wrong status" << std::endl;
+      std::exit(1);
+    }
+  }
+  if (batch.size() != count || batch.okCount() != 3 || batch.get(0, hU8) != 1 || batch.get(4, hU8) != 5 ||
+      std::get<uint64_t>(batch.at(2, "bit.mode").getValue()) != 5) {
+    std::cerr << "Batch values wrong" << std::endl;
+    std::exit(1);
+  }
+
+  // Rejected rows hold zeros of each field's type, so typed handles stay valid on them
+  auto hFloat = parser.fieldHandle<double>("test.float_val");
+  ByteParser flags;
+  flags.setTotalLength(4).setStartCode({0xA5}, 1).addField<bool>("flag", 1, 0, 1).addField<int8_t>("level", 2);
+  auto hFlag = flags.fieldHandle<bool>("flag");
+  auto hLevel = flags.fieldHandle<int64_t>("level");
+  const char flagFrames[] = {(char)0xA5, 1, -3, 0, 0x00, 1, -3, 0};
+  BatchResult flagBatch;
+  flags.parseBatch(flagFrames, 2, 4, flagBatch);
+  if (batch.get(1, hFloat) != 0.0 || batch.get(3, hFloat) != 0.0 || flagBatch.status(1) != FrameStatus::InvalidStartCode ||
+      !flagBatch.get(0, hFlag) || flagBatch.get(0, hLevel) != -3 || flagBatch.get(1, hFlag) || flagBatch.get(1, hLevel) != 0) {
+    std::cerr << "Rejected batch rows not typed" << std::endl;
+    std::exit(1);
+  }
+
+  // Reuse does not allocate
+  size_t before = g_allocations;
+  parser.parseBatch(data.data(), count, stride, batch);
+  if (g_allocations != before) {
+    std::cerr << "Batch re-parse allocated" << std::endl;
+    std::exit(1);
+  }
+
+  bool caught = false;
+  try {
+    parser.parseBatch(data.data(), count, 10, batch);
+  } catch (const std::exception &e) {
+    if (std::string(e.what()).find("Batch stride") != std::string::npos) caught = true;
+  }
+  if (!caught) {
+    std::cerr << "Batch stride error not reported" << std::endl;
+    std::exit(1);
+  }
+  std::cout << "test_parse_batch PASSED" << std::endl;
+}
+
+// Element of a column converted to double, for comparisons against ParsedValue
+double columnValue(const Column &column, size_t index) {
+  return std::visit([index](const auto &col) -> double { return static_cast<double>(col[index]); }, column);
+}
+
+// Equality that treats NaNs (random float bytes) as equal
+bool sameDouble(double a, double b) { return a == b || (std::isnan(a) && std::isnan(b)); }
+
+// Layout covering every column kind, used by the columnar tests
+const size_t kMixedLength = 32;
+
+ByteParser makeMixedParser() {
+  ByteParser parser;
+  parser.setTotalLength(kMixedLength)
+      .setStartCode({0xA5}, 1)
+      .setCRC("CRC16", 2)
+      .addField<uint8_t>("u8", 1)
+      .addField<int8_t>("i8", 2)
+      .addField<uint16_t>("u16", 3)
+      .addField<int16_t>("i16", 5, 0, 0, false)
+      .addField<uint32_t>("u32", 7, 0, 0, false)
+      .addField<int32_t>("i32.scaled", 11, 0, 0, true, 0.25, -3.0)
+      .addField<float>("f", 15, 0, 0, false)
+      .addField<bool>("flag", 19, 3, 1)
+      .addField<int16_t>("bits", 20, 4, 9)
+      .addField<bool>("byte_bool", 22, 0, 0)
+      .addField<uint32_t>("u32.scaled", 23, 0, 0, true, 0.5, 0.0)
+      .addField<int8_t>("i8.scaled", 27, 0, 0, true, 3.0, 1.0)
+      .addField<uint16_t>("u16.bits.scaled", 28, 2, 12, false, 0.1, 0.0);
+  return parser;
+}
+
+// Random frames for makeMixedParser() with valid start code and CRC
+std::vector<char> makeMixedFrames(size_t count, size_t stride, unsigned seed) {
+  std::vector<char> data(count * stride, 0);
+  std::srand(seed);
+  for (size_t i = 0; i < count; ++i) {
+    std::vector<char> frame(kMixedLength);
+    for (auto &b : frame) b = (char)(std::rand() & 0xFF);
+    frame[0] = (char)0xA5;
+    if (std::rand() % 3 == 0) frame[22] = 0;  // byte_bool false
+    uint16_t crc = calcCRC(frame, kMixedLength - 2);
+    frame[kMixedLength - 2] = crc & 0xFF;
+    frame[kMixedLength - 1] = (crc >> 8) & 0xFF;
+    std::copy(frame.begin(), frame.end(), data.begin() + i * stride);
+  }
+  return data;
+}
+
+void test_columnar_batch() {
+  std::cout << "Running test_columnar_batch..." << std::endl;
+  ByteParser parser;
+  parser.loadConfig("test_config.ini");
+
+  const size_t count = 130;  // Spans three words of a bit column
+  std::vector<char> data;
+  for (size_t i = 0; i < count; ++i) {
+    auto frame = makeConfigFrame((uint8_t)i);
+    frame[11] = (char)(i & 0x0F);
+    uint16_t crc = calcCRC(frame, 18);
+    frame[18] = crc & 0xFF;
+    frame[19] = (crc >> 8) & 0xFF;
+    data.insert(data.end(), frame.begin(), frame.end());
+  }
+  data[7 * 20 + 2] ^= 0x01;  // Frame 7: bad CRC
+
+  BatchResult rows;
+  ColumnarBatch columns;
+  parser.parseBatch(data.data(), count, 20, rows);
+  parser.parseBatch(data.data(), count, 20, columns);
+
+  if (columns.size() != count || columns.columnCount() != 6 || columns.okCount() != count - 1 ||
+      columns.status(7) != FrameStatus::CrcMismatch) {
+    std::cerr << "Columnar batch has wrong shape or status" << std::endl;
+    std::exit(1);
+  }
+  const auto &u8 = columns.column<uint8_t>(0);
+  const auto &mode = std::get<std::vector<uint8_t>>(columns.column("bit.mode"));
+  const auto &f = std::get<std::vector<double>>(columns.column("test.float_val"));
+  for (size_t i = 0; i < count; ++i) {
+    if (i == 7) continue;
+    if (u8[i] != i || mode[i] != ((i >> 1) & 7) || f[i] != 1.5) {
+      std::cerr << "Columnar value mismatch at frame " << i << std::endl;
+      std::exit(1);
+    }
+    for (size_t c = 0; c < columns.columnCount(); ++c) {
+      if (columnValue(columns.column(c), i) != rows.value(i, c).get<double>()) {
+        std::cerr << "Columnar differs from row batch at frame " << i << " column " << c << std::endl;
+        std::exit(1);
+      }
+    }
+  }
+
+  // Every column kind, including packed bools, matches the row decoder
+  ByteParser mixed = makeMixedParser();
+  const size_t mixedCount = 200;
+  auto mixedData = makeMixedFrames(mixedCount, kMixedLength, 7);
+  mixed.parseBatch(mixedData.data(), mixedCount, kMixedLength, rows);
+  mixed.parseBatch(mixedData.data(), mixedCount, kMixedLength, columns);
+  if (columns.okCount() != mixedCount || columns.column(7).index() != 7 || columns.column(8).index() != 2) {
+    std::cerr << "Mixed columnar batch has wrong shape" << std::endl;
+    std::exit(1);
+  }
+  for (size_t i = 0; i < mixedCount; ++i) {
+    for (size_t c = 0; c < columns.columnCount(); ++c) {
+      if (!sameDouble(columnValue(columns.column(c), i), rows.value(i, c).get<double>())) {
+        std::cerr << "Mixed columnar differs at frame " << i << " column " << c << std::endl;
+        std::exit(1);
+      }
+    }
+  }
+
+  // Reusing the batch for a smaller batch does not allocate
+  size_t before = g_allocations;
+  mixed.parseBatch(mixedData.data(), mixedCount / 2, kMixedLength, columns);
+  if (g_allocations != before || columns.size() != mixedCount / 2 || columns.bits(7).size() != mixedCount / 2) {
+    std::cerr << "Columnar batch reuse allocated or has wrong size" << std::endl;
+    std::exit(1);
+  }
+  std::cout << "test_columnar_batch PASSED" << std::endl;
+}
+
+void test_simd_columns() {
+  std::cout << "Running test_simd_columns..." << std::endl;
+  std::cout << "  Supported SIMD level: " << static_cast<int>(simd::supportedLevel()) << std::endl;
+  ByteParser parser = makeMixedParser();
+
+  // Odd counts and strides exercise the scalar tails and unaligned gathers
+  for (size_t stride : {kMixedLength, kMixedLength + 3}) {
+    for (size_t count : {size_t(1), size_t(7), size_t(64), size_t(203)}) {
+      auto data = makeMixedFrames(count, stride, (unsigned)(count + stride));
+      ColumnarBatch reference;
+      simd::setLevelLimit(simd::Level::Scalar);
+      parser.parseBatch(data.data(), count, stride, reference);
+
+      for (auto level : {simd::Level::SSE41, simd::Level::AVX2}) {
+        ColumnarBatch batch;
+        simd::setLevelLimit(level);
+        parser.parseBatch(data.data(), count, stride, batch);
+        for (size_t c = 0; c < batch.columnCount(); ++c) {
+          for (size_t i = 0; i < count; ++i) {
+            double expected = columnValue(reference.column(c), i);
+            double actual = columnValue(batch.column(c), i);
+            if (!sameDouble(expected, actual)) {
+              std::cerr << "SIMD level " << static_cast<int>(level) << " differs at column " << c << " frame " << i
+                        << " (stride " << stride << ", count " << count << "): " << actual << " != " << expected
+                        << std::endl;
+              std::exit(1);
+            }
+          }
+        }
+      }
+    }
+  }
+  simd::setLevelLimit(simd::Level::AVX2);
+  std::cout << "test_simd_columns PASSED" << std::endl;
+}
+
+void test_crc16_implementations() {
+  std::cout << "Running test_crc16_implementations..." << std::endl;
+  // CRC-16/MODBUS check value
+  const char *check = "123456789";
+  if (utils::calculateCRC16Modbus(reinterpret_cast<const uint8_t *>(check), 9) != 0x4B37) {
+    std::cerr << "CRC16 check value mismatch" << std::endl;
+    std::exit(1);
+  }
+
+  std::vector<uint8_t> data(1100);
+  std::srand(16);
+  for (auto &b : data) b = (uint8_t)(std::rand() & 0xFF);
+
+  // All lengths around the slicing block size and unaligned starts
+  for (size_t offset = 0; offset < 8; ++offset) {
+    for (size_t len = 0; len + offset <= data.size(); len += (len < 64 ? 1 : 97)) {
+      const uint8_t *p = data.data() + offset;
+      uint16_t expected = utils::calculateCRC16ModbusBitwise(p, len);
+      if (utils::crc16ModbusEngine().updateTable(0xFFFF, p, len) != expected ||
+          utils::calculateCRC16Modbus(p, len) != expected) {
+        std::cerr << "CRC16 mismatch at offset " << offset << " length " << len << std::endl;
+        std::exit(1);
+      }
+    }
+  }
+  std::cout << "test_crc16_implementations PASSED" << std::endl;
+}
+
+void test_crc_engine() {
+  std::cout << "Running test_crc_engine..." << std::endl;
+  std::cout << "  PCLMULQDQ available: " << utils::CrcEngine::clmulSupported() << std::endl;
+  const auto &modbus = utils::crc16ModbusEngine();
+  const utils::CrcEngine crc32({32, 0x04C11DB7, 0xFFFFFFFF, 0xFFFFFFFF});
+
+  const uint8_t *check = reinterpret_cast<const uint8_t *>("123456789");
+  if (modbus.compute(check, 9) != 0x4B37 || crc32.compute(check, 9) != 0xCBF43926) {
+    std::cerr << "CRC engine check values mismatch" << std::endl;
+    std::exit(1);
+  }
+
+  std::vector<uint8_t> data(5000);
+  std::srand(9);
+  for (auto &b : data) b = (uint8_t)(std::rand() & 0xFF);
+
+  for (size_t offset = 0; offset < 4; ++offset) {
+    for (size_t len = 0; len + offset <= data.size(); len += (len < 300 ? 1 : 131)) {
+      const uint8_t *p = data.data() + offset;
+      uint16_t expected = utils::calculateCRC16ModbusBitwise(p, len);
+      uint32_t crc32Table = crc32.updateTable(0xFFFFFFFF, p, len);
+      bool ok = modbus.compute(p, len) == expected && modbus.updateTable(0xFFFF, p, len) == expected;
+      if (utils::CrcEngine::clmulSupported()) {
+        ok = ok && modbus.updateClmul(0xFFFF, p, len) == expected && crc32.updateClmul(0xFFFFFFFF, p, len) == crc32Table;
+      }
+      if (!ok) {
+        std::cerr << "CRC engine mismatch at offset " << offset << " length " << len << std::endl;
+        std::exit(1);
+      }
+    }
+  }
+
+  // Large frames go through the engine inside parse()
+  ByteParser parser;
+  parser.setTotalLength(4096).setCRC("CRC16", 2).addField<uint32_t>("v", 0);
+  std::vector<char> frame(4096);
+  for (size_t i = 0; i < frame.size(); ++i) frame[i] = (char)data[i];
+  uint16_t crc = calcCRC(frame, 4094);
+  frame[4094] = crc & 0xFF;
+  frame[4095] = (crc >> 8) & 0xFF;
+  parser.parse(frame);
+  std::cout << "test_crc_engine PASSED" << std::endl;
+}
+
+void test_checksum_registry() {
+  std::cout << "Running test_checksum_registry..." << std::endl;
+  const uint8_t *check = reinterpret_cast<const uint8_t *>("123456789");
+  const std::vector<std::pair<std::string, uint32_t>> checkValues = {
+      {"CRC16", 0x4B37},  {"CRC16-MODBUS", 0x4B37}, {"CRC16-CCITT", 0x29B1}, {"CRC16-XMODEM", 0x31C3},
+      {"CRC32", 0xCBF43926}, {"CRC32C", 0xE3069283}, {"SUM8", 0xDD},        {"XOR8", 0x31}};
+  for (const auto &[name, expected] : checkValues) {
+    auto algorithm = checksum::find(name);
+    if (!algorithm || algorithm->compute(check, 9) != expected) {
+      std::cerr << "Checksum check value mismatch for " << name << std::endl;
+      std::exit(1);
+    }
+  }
+  if (checksum::find("CRC64")) {
+    std::cerr << "Unknown checksum should not be found" << std::endl;
+    std::exit(1);
+  }
+
+  // Hardware CRC32C against the generic engine
+  const utils::CrcEngine crc32c({32, 0x1EDC6F41, 0xFFFFFFFF, 0xFFFFFFFF});
+  auto hardware = checksum::find("CRC32C");
+  std::vector<uint8_t> data(600);
+  std::srand(10);
+  for (auto &b : data) b = (uint8_t)(std::rand() & 0xFF);
+  for (size_t offset = 0; offset < 8; ++offset) {
+    for (size_t len = 0; len + offset <= data.size(); ++len) {
+      if (hardware->compute(data.data() + offset, len) != crc32c.compute(data.data() + offset, len)) {
+        std::cerr << "CRC32C mismatch at offset " << offset << " length " << len << std::endl;
+        std::exit(1);
+      }
+    }
+  }
+
+  // INI: CRC32C big endian over bytes [2, 12), skipping the start code
+  ByteParser parser;
+  parser.loadConfig("test_config_crc32c.ini");
+  std::vector<char> frame = {(char)0xAA, 0x55, 0x78, 0x56, 0x34, 0x12, (char)0xFF, (char)0xFE, 0, 0, 0, 0};
+  uint32_t crc = hardware->compute(reinterpret_cast<const uint8_t *>(frame.data()) + 2, 10);
+  for (int shift = 24; shift >= 0; shift -= 8) frame.push_back((char)((crc >> shift) & 0xFF));
+  auto res = parser.parse(frame);
+  if (res["counter"].get<uint32_t>() != 0x12345678 || res["level"].get<double>() != -1.0) {
+    std::cerr << "CRC32C frame decoded incorrectly" << std::endl;
+    std::exit(1);
+  }
+  frame[0] = 0x00;  // Outside the coverage, only the start code check notices
+  try {
+    parser.parse(frame);
+    std::cerr << "Expected start code failure" << std::endl;
+    std::exit(1);
+  } catch (const std::runtime_error &e) {
+    if (std::string(e.what()).find("Start Code") == std::string::npos) {
+      std::cerr << "Unexpected error: " << e.what() << std::endl;
+      std::exit(1);
+    }
+  }
+  frame[0] = (char)0xAA;
+  frame[12] ^= 1;
+  try {
+    parser.parse(frame);
+    std::cerr << "Expected CRC32C failure" << std::endl;
+    std::exit(1);
+  } catch (const std::runtime_error &e) {
+    if (std::string(e.what()).find("CRC Check Failed") == std::string::npos) {
+      std::cerr << "Unexpected error: " << e.what() << std::endl;
+      std::exit(1);
+    }
+  }
+
+  // Configuration errors are reported by validateConfig()
+  auto expectInvalid = [](ByteParser &p, const std::string &message) {
+    try {
+      p.validateConfig();
+    } catch (const std::runtime_error &e) {
+      if (std::string(e.what()).find(message) != std::string::npos) return;
+      std::cerr << "Unexpected error: " << e.what() << std::endl;
+      std::exit(1);
+    }
+    std::cerr << "Expected validation failure: " << message << std::endl;
+    std::exit(1);
+  };
+  ByteParser bad;
+  bad.setTotalLength(8).setCRC("CRC64", 8);
+  expectInvalid(bad, "Unsupported CRC Algorithm: CRC64");
+  bad.setCRC("CRC32", 2);
+  expectInvalid(bad, "CRC32 algorithm requires CRCLength=4");
+  bad.setCRC("CRC32", 4).setCRCRange(0, 6);
+  expectInvalid(bad, "CRC range overlaps the CRC field");
+  bad.setCRCRange(3, 2);
+  expectInvalid(bad, "CRC range start exceeds its end");
+  ByteParser tiny;
+  tiny.setTotalLength(2).setCRC("CRC32", 4);
+  expectInvalid(tiny, "CRCLength exceeds TotalLength");
+  if (tiny.getCRCEnd() != 0) {
+    std::cerr << "getCRCEnd() underflowed for CRCLength > TotalLength" << std::endl;
+    std::exit(1);
+  }
+
+  // Custom algorithms plug into the same registry, batches report mismatches per frame
+  checksum::registerAlgorithm({"TEST-NEG8", 1, [](const uint8_t *p, size_t len) {
+                                 uint8_t sum = 0;
+                                 for (size_t i = 0; i < len; ++i) sum = (uint8_t)(sum + p[i]);
+                                 return (uint32_t)(uint8_t)(0 - sum);
+                               }});
+  ByteParser custom;
+  custom.setTotalLength(3).setCRC("TEST-NEG8", 1).addField<uint16_t>("v", 0);
+  std::vector<char> frames = {0x01, 0x02, (char)0xFD, 0x10, 0x00, (char)0xF0, 0x10, 0x00, 0x00};
+  BatchResult batch;
+  custom.parseBatch(frames.data(), 3, 3, batch);
+  if (batch.status(0) != FrameStatus::Ok || batch.status(1) != FrameStatus::Ok ||
+      batch.status(2) != FrameStatus::CrcMismatch) {
+    std::cerr << "Custom checksum statuses wrong" << std::endl;
+    std::exit(1);
+  }
+  std::cout << "test_checksum_registry PASSED" << std::endl;
+}
+
+// Valid frames separated by garbage, false start codes, a corrupted and a truncated frame
+static void makeFramerStream(std::vector<char> &stream, std::vector<uint8_t> &expected) {
+  std::srand(11);
+  auto append = [&](const std::vector<char> &bytes) { stream.insert(stream.end(), bytes.begin(), bytes.end()); };
+  for (uint8_t v = 0; v < 40; ++v) {
+    if (v % 3 == 0) {
+      for (int i = 0; i < v; ++i) stream.push_back((char)(std::rand() & 0xFF));
+      append({0x02, 0x03, 0x11, 0x02});
+    }
+    if (v % 7 == 1) {
+      std::vector<char> bad = makeConfigFrame(v);
+      bad[5] ^= 0x40;
+      append(bad);
+      continue;
+    }
+    if (v % 11 == 2) {
+      std::vector<char> cut = makeConfigFrame(v);
+      cut.resize(12);
+      append(cut);  // The next frame starts inside the rejected candidate
+    }
+    append(makeConfigFrame(v));
+    expected.push_back(v);
+  }
+
+}
+
+void test_stream_framer() {
+  std::cout << "Running test_stream_framer..." << std::endl;
+  ByteParser parser;
+  parser.loadConfig("test_config.ini");
+
+  std::vector<char> stream;
+  std::vector<uint8_t> expected;
+  makeFramerStream(stream, expected);
+
+  for (size_t chunk : {(size_t)1, (size_t)3, (size_t)7, (size_t)20, (size_t)64, stream.size()}) {
+    StreamFramer framer(parser);
+    std::vector<uint8_t> got;
+    for (size_t pos = 0; pos < stream.size(); pos += chunk) {
+      framer.feed(stream.data() + pos, std::min(chunk, stream.size() - pos),
+                  [&](const ParseResult &r) { got.push_back((uint8_t)r.at("test.uint8_val").get<uint64_t>()); });
+    }
+    if (got != expected || framer.stats().frames != expected.size() || framer.pending() != 0) {
+      std::cerr << "StreamFramer callback mismatch with chunk size " << chunk << ": got " << got.size() << " of "
+                << expected.size() << " frames" << std::endl;
+      std::exit(1);
+    }
+    if (framer.stats().crcErrors < 6 || framer.stats().discardedBytes == 0) {
+      std::cerr << "StreamFramer statistics wrong with chunk size " << chunk << std::endl;
+      std::exit(1);
+    }
+
+    StreamFramer batchFramer(parser);
+    BatchResult batch;
+    std::vector<uint8_t> batched;
+    for (size_t pos = 0; pos < stream.size(); pos += chunk) {
+      batchFramer.feed(stream.data() + pos, std::min(chunk, stream.size() - pos), batch);
+      for (size_t i = 0; i < batch.size(); ++i) {
+        batched.push_back((uint8_t)batch.at(i, "test.uint8_val").get<uint64_t>());
+      }
+    }
+    if (batched != expected || batchFramer.stats().discardedBytes != framer.stats().discardedBytes) {
+      std::cerr << "StreamFramer batch mismatch with chunk size " << chunk << std::endl;
+      std::exit(1);
+    }
+  }
+
+  // A partial frame stays pending until the rest arrives
+  StreamFramer framer(parser);
+  std::vector<char> frame = makeConfigFrame(42);
+  size_t calls = 0;
+  auto count = [&](const ParseResult &) { ++calls; };
+  framer.feed(frame.data(), 1, count);
+  framer.feed(frame.data() + 1, 10, count);
+  if (framer.pending() != 11 || calls != 0) {
+    std::cerr << "StreamFramer should buffer a partial frame" << std::endl;
+    std::exit(1);
+  }
+  framer.feed(frame.data() + 11, 9, count);
+  if (framer.pending() != 0 || calls != 1) {
+    std::cerr << "StreamFramer should complete a split frame" << std::endl;
+    std::exit(1);
+  }
+  std::cout << "test_stream_framer PASSED" << std::endl;
+}
+
+void test_start_code_scan() {
+  std::cout << "Running test_start_code_scan..." << std::endl;
+  // Few distinct byte values so that first/last byte hits with a middle mismatch are common
+  std::vector<char> data(700);
+  std::srand(12);
+  for (auto &b : data) b = (char)(std::rand() % 4);
+
+  const uint8_t codes[][5] = {{2}, {2, 3}, {2, 1, 3}, {3, 0, 2, 1}, {1, 1, 2, 0, 3}};
+  for (size_t length = 1; length <= 5; ++length) {
+    const uint8_t *code = codes[length - 1];
+    for (size_t offset = 0; offset < 5; ++offset) {
+      for (size_t size = 0; size + offset <= data.size(); size += (size < 100 ? 1 : 37)) {
+        const char *p = data.data() + offset;
+        size_t expected = utils::findStartCode(p, size, code, length);
+        for (auto level : {simd::Level::Scalar, simd::Level::SSE41, simd::Level::AVX2}) {
+          simd::setLevelLimit(level);
+          if (simd::findStartCode(p, size, code, length) != expected) {
+            std::cerr << "Start code scan mismatch at level " << static_cast<int>(level) << " length " << length
+                      << " offset " << offset << " size " << size << std::endl;
+            std::exit(1);
+          }
+        }
+      }
+    }
+  }
+  simd::setLevelLimit(simd::Level::AVX2);
+  std::cout << "test_start_code_scan PASSED" << std::endl;
+}
+
+void test_ring_buffer() {
+  std::cout << "Running test_ring_buffer..." << std::endl;
+  std::cout << "  Mirrored mapping available: " << RingBuffer(1, 1).mirrored() << std::endl;
+  RingBuffer small(100, 20, false);
+  if (small.capacity() != 128 || small.mirrored() || small.write(std::vector<char>(200).data(), 200) != 128) {
+    std::cerr << "RingBuffer capacity or fill level wrong" << std::endl;
+    std::exit(1);
+  }
+
+  ByteParser parser;
+  parser.loadConfig("test_config.ini");
+  std::vector<char> once;
+  std::vector<uint8_t> expectedOnce;
+  makeFramerStream(once, expectedOnce);
+  // Several passes, so that frames wrap around the end of the ring many times
+  std::vector<char> stream;
+  std::vector<uint8_t> expected;
+  for (int pass = 0; pass < 6; ++pass) {
+    stream.insert(stream.end(), once.begin(), once.end());
+    expected.insert(expected.end(), expectedOnce.begin(), expectedOnce.end());
+  }
+
+  for (bool mirror : {true, false}) {
+    for (size_t chunk : {(size_t)1, (size_t)7, (size_t)33, (size_t)500}) {
+      RingBuffer ring(64, 20, mirror);
+      StreamFramer framer(parser);
+      BatchResult batch;
+      std::vector<uint8_t> got;
+      auto onFrame = [&](const ParseResult &r) { got.push_back((uint8_t)r.at("test.uint8_val").get<uint64_t>()); };
+      bool useBatch = chunk == 33;
+
+      // Start on the copying path so that the ring also has to complete a carried frame
+      framer.feed(stream.data(), 30, onFrame);
+      for (size_t pos = 30; pos < stream.size();) {
+        pos += ring.write(stream.data() + pos, std::min(chunk, stream.size() - pos));
+        if (!useBatch) {
+          framer.feed(ring, onFrame);
+          continue;
+        }
+        framer.feed(ring, batch);
+        for (size_t i = 0; i < batch.size(); ++i) got.push_back((uint8_t)batch.at(i, "test.uint8_val").get<uint64_t>());
+      }
+      if (got != expected || ring.readable() != 0 || framer.pending() != 0) {
+        std::cerr << "StreamFramer over RingBuffer (mirror " << mirror << ", chunk " << chunk << ") got " << got.size()
+                  << " of " << expected.size() << " frames" << std::endl;
+        std::exit(1);
+      }
+    }
+  }
+
+  // Without mirroring the slack must hold a whole frame
+  RingBuffer narrow(64, 8, false);
+  StreamFramer framer(parser);
+  try {
+    framer.feed(narrow, [](const ParseResult &) {});
+    std::cerr << "StreamFramer should reject a RingBuffer with too little slack" << std::endl;
+    std::exit(1);
+  } catch (const std::invalid_argument &) {
+  }
+  std::cout << "test_ring_buffer PASSED" << std::endl;
+}
+
+void test_parse_file() {
+  std::cout << "Running test_parse_file..." << std::endl;
+  ByteParser parser;
+  parser.loadConfig("test_config.ini");
+
+  const size_t frameCount = 1000;
+  const char *path = "test_capture.bin";
+  {
+    std::ofstream out(path, std::ios::binary);
+    for (size_t i = 0; i < frameCount; ++i) {
+      std::vector<char> frame = makeConfigFrame((uint8_t)i);
+      if (i == 500) frame[5] ^= 0x40;
+      out.write(frame.data(), (std::streamsize)frame.size());
+    }
+    out.write("\x02\x03\x00", 3);
+  }
+
+  std::vector<uint8_t> values(frameCount);
+  size_t nextFrame = 0;
+  FileParseStats stats = parser.parseFile(
+      path,
+      [&](const BatchResult &batch, size_t first) {
+        if (first != nextFrame) {
+          std::cerr << "parseFile batches out of order" << std::endl;
+          std::exit(1);
+        }
+        for (size_t i = 0; i < batch.size(); ++i) {
+          if (batch.status(i) != FrameStatus::Ok) continue;
+          values[first + i] = (uint8_t)batch.at(i, "test.uint8_val").get<uint64_t>();
+        }
+        nextFrame += batch.size();
+      },
+      64);
+  if (stats.frames != frameCount || stats.okFrames != frameCount - 1 || stats.trailingBytes != 3 ||
+      stats.bytes != frameCount * parser.getTotalLength() + 3 || values[999] != (uint8_t)999) {
+    std::cerr << "parseFile statistics or values wrong" << std::endl;
+    std::exit(1);
+  }
+  std::cout << "  " << stats.framesPerSecond() << " frames/s, " << stats.megabytesPerSecond() << " MB/s" << std::endl;
+
+  size_t columnarFrames = 0;
+  parser.parseFile(path, [&](const ColumnarBatch &batch, size_t) { columnarFrames += batch.size(); });
+  if (columnarFrames != frameCount) {
+    std::cerr << "parseFile columnar sink got " << columnarFrames << " frames" << std::endl;
+    std::exit(1);
+  }
+  std::remove(path);
+
+  try {
+    parser.parseFile("no_such_capture.bin", [](const BatchResult &, size_t) {});
+    std::cerr << "parseFile should throw for a missing file" << std::endl;
+    std::exit(1);
+  } catch (const std::runtime_error &) {
+  }
+  std::cout << "test_parse_file PASSED" << std::endl;
+}
+
+void test_parallel_batch() {
+  std::cout << "Running test_parallel_batch..." << std::endl;
+  ByteParser parser = makeMixedParser();
+  WorkerPool pool(4);
+
+  // Several chunks plus a partial one, with some corrupted frames
+  const size_t count = 3 * 4096 + 77;
+  auto data = makeMixedFrames(count, kMixedLength, 15);
+  for (size_t i = 0; i < count; i += 997) data[i * kMixedLength + 4] ^= 0x10;
+
+  ColumnarBatch serial, parallel;
+  parser.parseBatch(data.data(), count, kMixedLength, serial);
+  parser.parseBatch(data.data(), count, kMixedLength, parallel, pool);
+  if (parallel.size() != count || parallel.okCount() != serial.okCount() || parallel.statuses() != serial.statuses()) {
+    std::cerr << "Parallel columnar batch statuses differ" << std::endl;
+    std::exit(1);
+  }
+  for (size_t c = 0; c < serial.columnCount(); ++c) {
+    for (size_t i = 0; i < count; ++i) {
+      if (serial.status(i) == FrameStatus::Ok &&
+          !sameDouble(columnValue(serial.column(c), i), columnValue(parallel.column(c), i))) {
+        std::cerr << "Parallel columnar batch differs at column " << c << " frame " << i << std::endl;
+        std::exit(1);
+      }
+    }
+  }
+
+  BatchResult rows, parallelRows;
+  parser.parseBatch(data.data(), count, kMixedLength, rows);
+  parser.parseBatch(data.data(), count, kMixedLength, parallelRows, pool);
+  if (parallelRows.okCount() != rows.okCount() || parallelRows.statuses() != rows.statuses()) {
+    std::cerr << "Parallel row batch statuses differ" << std::endl;
+    std::exit(1);
+  }
+  for (size_t i = 0; i < count; ++i) {
+    if (rows.status(i) == FrameStatus::Ok &&
+        rows.value(i, 4).get<uint64_t>() != parallelRows.value(i, 4).get<uint64_t>()) {
+      std::cerr << "Parallel row batch differs at frame " << i << std::endl;
+      std::exit(1);
+    }
+  }
+
+  // Every task runs exactly once, exceptions reach the caller
+  std::vector<std::atomic<int>> runs(1000);
+  pool.run(runs.size(), [&](size_t i) { ++runs[i]; });
+  for (auto &n : runs) {
+    if (n != 1) {
+      std::cerr << "WorkerPool ran a task " << n << " times" << std::endl;
+      std::exit(1);
+    }
+  }
+  try {
+    pool.run(10, [](size_t i) {
+      if (i == 7) throw std::runtime_error("task failed");
+    });
+    std::cerr << "WorkerPool should rethrow task exceptions" << std::endl;
+    std::exit(1);
+  } catch (const std::runtime_error &) {
+  }
+  std::cout << "test_parallel_batch PASSED" << std::endl;
+}
+
+void test_pipeline() {
+  std::cout << "Running test_pipeline..." << std::endl;
+  ByteParser parser = makeMixedParser();
+  parser.compile();
+
+  const size_t count = 20000;
+  auto data = makeMixedFrames(count, kMixedLength, 17);
+  for (size_t i = 0; i < count; i += 97) data[i * kMixedLength + 8] ^= 0x02;
+  BatchResult reference;
+  parser.parseBatch(data.data(), count, kMixedLength, reference);
+
+  // Small queues so that both sides run into backpressure
+  SpscQueue<FrameSlice> slices(8);
+  SpscQueue<ParsedFrame> parsed(4);
+  ParseStage<SpscQueue<FrameSlice>, SpscQueue<ParsedFrame>> stage(parser, slices, parsed);
+  std::atomic<bool> stop{false};
+
+  std::thread producer([&] {
+    for (size_t i = 0; i < count; ++i) {
+      FrameSlice slice{data.data() + i * kMixedLength, i == 5 ? size_t(3) : kMixedLength, i};
+      while (!slices.tryPush(slice)) std::this_thread::yield();
+    }
+    stop = true;
+  });
+  std::thread parserThread([&] { stage.run(stop); });
+
+  size_t received = 0, wrong = 0;
+  ParsedFrame frame;
+  while (received < count) {
+    if (!parsed.tryPop(frame)) {
+      std::this_thread::yield();
+      continue;
+    }
+    FrameStatus expected = frame.sequence == 5 ? FrameStatus::TooShort : reference.status(frame.sequence);
+    if (frame.sequence != received || frame.status != expected) ++wrong;
+    if (frame.status == FrameStatus::Ok &&
+        frame.result[4].get<uint64_t>() != reference.value(received, 4).get<uint64_t>()) {
+      ++wrong;
+    }
+    ++received;
+  }
+  producer.join();
+  parserThread.join();
+  const size_t invalid = count - reference.okCount() + (reference.status(5) == FrameStatus::Ok);
+  if (wrong != 0 || stage.stats().consumed != count || stage.stats().invalid != invalid) {
+    std::cerr << "Pipeline delivered " << wrong << " wrong frames, " << stage.stats().invalid << " invalid" << std::endl;
+    std::exit(1);
+  }
+
+  // MPMC: every value arrives exactly once across 3 producers and 3 consumers
+  MpmcQueue<uint64_t> queue(16);
+  const uint64_t perProducer = 20000;
+  std::atomic<uint64_t> sum{0}, popped{0};
+  std::vector<std::thread> threads;
+  for (uint64_t p = 0; p < 3; ++p) {
+    threads.emplace_back([&, p] {
+      for (uint64_t i = 1; i <= perProducer; ++i) {
+        uint64_t value = p * perProducer + i;
+        while (!queue.tryPush(value)) std::this_thread::yield();
+      }
+    });
+    threads.emplace_back([&] {
+      uint64_t value = 0;
+      while (popped < 3 * perProducer) {
+        if (queue.tryPop(value)) {
+          sum += value;
+          ++popped;
+        } else {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+  for (auto &thread : threads) thread.join();
+  const uint64_t n = 3 * perProducer;
+  if (popped != n || sum != n * (n + 1) / 2) {
+    std::cerr << "MpmcQueue lost or duplicated values" << std::endl;
+    std::exit(1);
+  }
+  std::cout << "test_pipeline PASSED" << std::endl;
+}
+
+void test_projection() {
+  std::cout << "Running test_projection..." << std::endl;
+  ByteParser parser = makeMixedParser();
+  ByteParser projection = parser.select({"u32.scaled", "flag", "i16", "flag"});
+
+  const size_t count = 300;
+  auto data = makeMixedFrames(count, kMixedLength, 18);
+  data[7 * kMixedLength + 9] ^= 0x01;
+  BatchResult full, selected;
+  parser.parseBatch(data.data(), count, kMixedLength, full);
+  projection.parseBatch(data.data(), count, kMixedLength, selected);
+  if (selected.fieldCount() != 3 || selected.statuses() != full.statuses()) {
+    std::cerr << "Projection has wrong fields or frame statuses" << std::endl;
+    std::exit(1);
+  }
+  for (size_t i = 0; i < count; ++i) {
+    if (full.status(i) != FrameStatus::Ok) continue;
+    for (const char *name : {"u32.scaled", "flag", "i16"}) {
+      if (selected.at(i, name).toString() != full.at(i, name).toString()) {
+        std::cerr << "Projection differs for " << name << " at frame " << i << std::endl;
+        std::exit(1);
+      }
+    }
+  }
+
+  // Only the selected fields are decoded into a ParseResult, in the selected order
+  ParseResult result;
+  projection.parse(data.data(), kMixedLength, result);
+  auto flag = projection.fieldHandle<bool>("flag");
+  if (result.size() != 3 || result.nameAt(0) != "u32.scaled" || flag.index() != 1 ||
+      result.get(flag) != full.at(0, "flag").get<bool>()) {
+    std::cerr << "Projected ParseResult has wrong layout" << std::endl;
+    std::exit(1);
+  }
+
+  ColumnarBatch columns;
+  projection.parseBatch(data.data(), count, kMixedLength, columns);
+  if (columns.columnCount() != 3) {
+    std::cerr << "Projected columnar batch has " << columns.columnCount() << " columns" << std::endl;
+    std::exit(1);
+  }
+
+  try {
+    (void)parser.select({"u8", "no_such_field"});
+    std::cerr << "select() should reject unknown fields" << std::endl;
+    std::exit(1);
+  } catch (const std::out_of_range &) {
+  }
+  std::cout << "test_projection PASSED" << std::endl;
+}
+
+void test_filters() {
+  std::cout << "Running test_filters..." << std::endl;
+  ByteParser parser;
+  parser.loadConfig("test_config_filter.ini");
+  if (parser.getFilters().size() != 3) {
+    std::cerr << "[Filter] section not loaded" << std::endl;
+    std::exit(1);
+  }
+
+  // Frames 0..29, 10..29 pass except 25; frame 3 (filtered anyway) and frame 15 (kept by the filter) have a bad CRC
+  const size_t count = 30;
+  std::vector<char> data;
+  for (size_t v = 0; v < count; ++v) {
+    std::vector<char> frame = makeConfigFrame((uint8_t)v);
+    if (v == 3 || v == 15) frame[18] ^= 0x01;
+    data.insert(data.end(), frame.begin(), frame.end());
+  }
+  BatchResult batch;
+  parser.parseBatch(data.data(), count, 20, batch);
+  std::vector<size_t> expected;
+  for (size_t v = 10; v < count; ++v)
+    if (v != 15 && v != 25) expected.push_back(v);
+  if (batch.selection() != expected || batch.status(3) != FrameStatus::Filtered ||
+      batch.status(15) != FrameStatus::CrcMismatch || batch.status(25) != FrameStatus::Filtered || batch.okCount() != expected.size()) {
+    std::cerr << "Filtered batch has wrong statuses or selection" << std::endl;
+    std::exit(1);
+  }
+
+  ParseResult result;
+  if (parser.tryParse(data.data(), 20, result) != FrameStatus::Filtered) {
+    std::cerr << "tryParse should report filtered frames" << std::endl;
+    std::exit(1);
+  }
+  try {
+    parser.parse(data.data(), 20, result);
+    std::cerr << "parse() should throw for filtered frames" << std::endl;
+    std::exit(1);
+  } catch (const std::runtime_error &) {
+  }
+
+  // The framer skips filtered frames as a whole instead of resynchronizing inside them
+  StreamFramer framer(parser);
+  size_t framed = 0;
+  framer.feed(data.data(), data.size(), [&](const ParseResult &) { ++framed; });
+  if (framed != expected.size() || framer.stats().filtered != 10 || framer.stats().discardedBytes != 20 + 20) {
+    std::cerr << "StreamFramer with filters framed " << framed << ", filtered " << framer.stats().filtered
+              << ", discarded " << framer.stats().discardedBytes << std::endl;
+    std::exit(1);
+  }
+
+  // Sparse columnar decode of the few surviving frames, bool columns included
+  ByteParser mixed = makeMixedParser();
+  ByteParser filtered = makeMixedParser();
+  filtered.addFilter("u8", "<", 26).addFilter("f", CompareOp::Ne, 12345.0);
+  const size_t n = 3000;
+  auto frames = makeMixedFrames(n, kMixedLength, 19);
+  ColumnarBatch all, kept;
+  mixed.parseBatch(frames.data(), n, kMixedLength, all);
+  filtered.parseBatch(frames.data(), n, kMixedLength, kept);
+  size_t expectedKept = 0;
+  for (size_t i = 0; i < n; ++i) expectedKept += (uint8_t)frames[i * kMixedLength + 1] < 26;
+  if (kept.selection().size() != expectedKept || expectedKept == 0) {
+    std::cerr << "Filtered columnar batch kept " << kept.selection().size() << " of " << expectedKept << std::endl;
+    std::exit(1);
+  }
+  for (size_t i : kept.selection()) {
+    for (size_t c = 0; c < kept.columnCount(); ++c) {
+      if (!sameDouble(columnValue(all.column(c), i), columnValue(kept.column(c), i))) {
+        std::cerr << "Filtered columnar batch differs at column " << c << " frame " << i << std::endl;
+        std::exit(1);
+      }
+    }
+  }
+
+  // Filters keep working on fields left out by a projection
+  ByteParser projection = filtered.select({"i16", "flag"});
+  ColumnarBatch projected;
+  projection.parseBatch(frames.data(), n, kMixedLength, projected);
+  if (projected.selection() != kept.selection()) {
+    std::cerr << "Projection lost its filters" << std::endl;
+    std::exit(1);
+  }
+
+  bool caught = false;
+  try {
+    ByteParser bad = makeMixedParser();
+    bad.addFilter("no_such_field", CompareOp::Eq, 1.0).compile();
+  } catch (const std::runtime_error &) {
+    caught = true;
+  }
+  try {
+    filtered.addFilter("u8", "=<", 1.0);
+    caught = false;
+  } catch (const std::runtime_error &) {
+  }
+  try {
+    ByteParser reserved;
+    reserved.setTotalLength(4).addField<uint8_t>("Filter", 0).compile();
+    caught = false;
+  } catch (const std::runtime_error &e) {
+    if (std::string(e.what()).find("reserved") == std::string::npos) caught = false;
+  }
+  if (!caught) {
+    std::cerr << "Invalid filters should be rejected" << std::endl;
+    std::exit(1);
+  }
+
+  // A projection of an unvalidated parser must not keep a filter field outside the frame
+  caught = false;
+  try {
+    ByteParser outside;
+    outside.setTotalLength(8).addField<uint8_t>("a", 0).addField<uint32_t>("far", 100);
+    outside.addFilter("far", CompareOp::Gt, 1.0);
+    ByteParser projection = outside.select({"a"});
+  } catch (const std::runtime_error &) {
+    caught = true;
+  }
+  if (!caught) {
+    std::cerr << "Projection with an out-of-range filter field should be rejected" << std::endl;
+    std::exit(1);
+  }
+  std::cout << "test_filters PASSED" << std::endl;
+}
+
+void test_frame_view() {
+  std::cout << "Running test_frame_view..." << std::endl;
+  ByteParser parser;
+  parser.loadConfig("test_config.ini");
+  std::vector<char> frame = makeConfigFrame(42);
+
+  ParseResult parsed;
+  parser.parse(frame.data(), frame.size(), parsed);
+  FrameView view = parser.view(frame.data(), frame.size());
+  if (view.size() != parsed.size() || view.data() != frame.data()) {
+    std::cerr << "FrameView has the wrong layout or frame" << std::endl;
+    std::exit(1);
+  }
+  for (size_t i = 0; i < view.size(); ++i) {
+    if (view[i].getValue() != parsed[i].getValue() || view.nameAt(i) != parsed.nameAt(i)) {
+      std::cerr << "FrameView differs from parse() at " << parsed.nameAt(i) << std::endl;
+      std::exit(1);
+    }
+  }
+  auto handle = parser.fieldHandle<uint64_t>("test.uint8_val");
+  if (view.get(handle) != 42 || view.at("bit.mode").get<uint64_t>() != 5) {
+    std::cerr << "FrameView typed access failed" << std::endl;
+    std::exit(1);
+  }
+  try {
+    (void)view.at("no_such_field");
+    std::cerr << "FrameView::at() should throw for unknown fields" << std::endl;
+    std::exit(1);
+  } catch (const std::out_of_range &) {
+  }
+
+  // Frame checks are the same as parse()
+  std::vector<char> corrupt = frame;
+  corrupt[18] ^= 0x01;
+  if (parser.tryView(corrupt.data(), corrupt.size(), view) != FrameStatus::CrcMismatch ||
+      parser.tryView(frame.data(), 10, view) != FrameStatus::TooShort || view.data() != frame.data()) {
+    std::cerr << "tryView() should report failed checks and keep the view" << std::endl;
+    std::exit(1);
+  }
+  try {
+    (void)parser.view(corrupt.data(), corrupt.size());
+    std::cerr << "view() should throw for a CRC mismatch" << std::endl;
+    std::exit(1);
+  } catch (const std::runtime_error &) {
+  }
+
+  // The view keeps the layout it was created with
+  parser.addField<uint8_t>("extra", 12);
+  parser.compile();
+  if (view.size() != parsed.size() || view.get(handle) != 42) {
+    std::cerr << "FrameView lost its layout after a reconfiguration" << std::endl;
+    std::exit(1);
+  }
+  std::cout << "test_frame_view PASSED" << std::endl;
+}
+
+// test_config.ini as a compile-time schema
+EBP_FIELD_NAME(Uint8Val, "test.uint8_val");
+EBP_FIELD_NAME(Uint16Big, "test.uint16_big");
+EBP_FIELD_NAME(Uint16Little, "test.uint16_little");
+EBP_FIELD_NAME(FloatVal, "test.float_val");
+EBP_FIELD_NAME(Flag1, "bit.flag1");
+EBP_FIELD_NAME(Mode, "bit.mode");
+using ConfigSchema =
+    Schema<Frame<20, 2, 2>, Field<Uint8Val, uint8_t, 2>, Field<Uint16Big, uint16_t, 3>,
+           Field<Uint16Little, uint16_t, 5, LittleEndian>,
+           Field<FloatVal, float, 7, BigEndian, NoBits, std::ratio<2>, std::ratio<3, 2>>,
+           Field<Flag1, uint8_t, 11, BigEndian, Bits<0, 1>>, Field<Mode, uint8_t, 11, BigEndian, Bits<1, 3>>>;
+
+static_assert(ConfigSchema::fieldCount == 6 && ConfigSchema::totalLength == 20);
+static_assert(std::is_same_v<decltype(ConfigSchema::decodeField<Uint16Little>(nullptr)), uint16_t>);
+static_assert(std::is_same_v<decltype(ConfigSchema::decodeField<FloatVal>(nullptr)), double>);
+static_assert(std::is_same_v<decltype(ConfigSchema::decodeField<Mode>(nullptr)), uint8_t>);
+
+template <size_t I>
+static double schemaValue(const ConfigSchema::Values &values) {
+  return static_cast<double>(values.get<I>());
+}
+
+void test_schema() {
+  std::cout << "Running test_schema..." << std::endl;
+  ByteParser parser;
+  parser.loadConfig("test_config.ini");
+  auto numbers = [](const ConfigSchema::Values &v) {
+    return std::vector<double>{schemaValue<0>(v), schemaValue<1>(v), schemaValue<2>(v),
+                               schemaValue<3>(v), schemaValue<4>(v), schemaValue<5>(v)};
+  };
+
+  std::srand(21);
+  ParseResult result;
+  ConfigSchema::Values values;
+  for (int n = 0; n < 200; ++n) {
+    std::vector<char> frame(20);
+    for (auto &b : frame) b = static_cast<char>(std::rand() & 0xFF);
+    frame[0] = 0x02;
+    frame[1] = 0x03;
+    uint16_t crc = calcCRC(frame, 18);
+    frame[18] = crc & 0xFF;
+    frame[19] = (crc >> 8) & 0xFF;
+    if (parser.check(frame.data(), frame.size()) != FrameStatus::Ok) {
+      std::cerr << "check() rejected a valid frame" << std::endl;
+      std::exit(1);
+    }
+
+    parser.parse(frame.data(), frame.size(), result);
+    ConfigSchema::decode(frame.data(), values);
+    std::vector<double> decoded = numbers(values);
+    for (size_t i = 0; i < decoded.size(); ++i) {
+      double expected = result[i].get<double>();
+      if (!(decoded[i] == expected || (std::isnan(decoded[i]) && std::isnan(expected)))) {
+        std::cerr << "Schema differs from parse() at " << result.nameAt(i) << ": " << decoded[i] << " vs " << expected
+                  << std::endl;
+        std::exit(1);
+      }
+    }
+    if (values.get<Mode>() != ConfigSchema::decodeField<Mode>(frame.data())) {
+      std::cerr << "Schema::decodeField() differs from decode()" << std::endl;
+      std::exit(1);
+    }
+  }
+
+  // The runtime equivalent matches the INI configuration
+  ByteParser configured;
+  configured.setStartCode({0x02, 0x03}, 2).setCRC("CRC16", 2);
+  ConfigSchema::configure(configured).compile();
+  if (configured.getConfigurationChecklist() != parser.getConfigurationChecklist()) {
+    std::cerr << "Schema::configure() differs from test_config.ini" << std::endl;
+    std::cerr << configured.getConfigurationChecklist() << parser.getConfigurationChecklist() << std::endl;
+    std::exit(1);
+  }
+  std::cout << "test_schema PASSED" << std::endl;
+}
+
+#ifdef EBP_TEST_CODEGEN
+void test_codegen() {
+  std::cout << "Running test_codegen..." << std::endl;
+  static_assert(std::is_same_v<decltype(generated::TestConfig::test_float_val), double>);
+  static_assert(std::is_same_v<decltype(generated::TestConfig::bit_mode), uint8_t>);
+  static_assert(generated::TestConfig::totalLength == 20 && generated::TestConfig::fieldCount == 6);
+
+  ByteParser parser;
+  parser.loadConfig("test_config.ini");
+  std::srand(22);
+  ParseResult result;
+  generated::TestConfig decoded;
+  for (int n = 0; n < 200; ++n) {
+    std::vector<char> frame(20);
+    for (auto &b : frame) b = static_cast<char>(std::rand() & 0xFF);
+    frame[0] = 0x02;
+    frame[1] = 0x03;
+    uint16_t crc = calcCRC(frame, 18);
+    frame[18] = crc & 0xFF;
+    frame[19] = (crc >> 8) & 0xFF;
+
+    parser.parse(frame.data(), frame.size(), result);
+    generated::decode(frame.data(), decoded);
+    const double values[] = {static_cast<double>(decoded.test_uint8_val),     static_cast<double>(decoded.test_uint16_big),
+                             static_cast<double>(decoded.test_uint16_little), decoded.test_float_val,
+                             static_cast<double>(decoded.bit_flag1),          static_cast<double>(decoded.bit_mode)};
+    for (size_t i = 0; i < result.size(); ++i) {
+      double expected = result[i].get<double>();
+      if (!(values[i] == expected || (std::isnan(values[i]) && std::isnan(expected)))) {
+        std::cerr << "Generated decoder differs from parse() at " << result.nameAt(i) << ": " << values[i] << " vs "
+                  << expected << std::endl;
+        std::exit(1);
+      }
+    }
+  }
+
+  // Keywords, constants and leading digits become valid member names
+  std::vector<char> frame = {0x02, 7, 0x12, 0x34, 9, -5, 0, 0, 0, 0};
+  ByteParser names;
+  names.loadConfig("test_config_names.ini");
+  generated::TestConfigNames named;
+  generated::decode(frame.data(), named);
+  if (named.class_ != 7 || named.int_ != 0x1234 || named.crcLength_ != 9 || named._2nd_value != -5 ||
+      generated::TestConfigNames::crcLength != names.getCRCLength() ||
+      std::string(generated::TestConfigNames::crcAlgo) != names.getCRCAlgo()) {
+    std::cerr << "Generated decoder with renamed members is wrong" << std::endl;
+    std::exit(1);
+  }
+  std::cout << "test_codegen PASSED" << std::endl;
+}
+#endif
+
+// Interpreted and JIT-compiled FlatResult decoding against parse(), slot for slot
+static void checkFlatDecoding(ByteParser &parser, const std::vector<char> &frames, size_t count) {
+  const size_t length = parser.getTotalLength();
+  ByteParser interpreted = parser;
+  interpreted.setJit(false).compile();
+  parser.setJit(true);
+  parser.compile();
+#if defined(EBP_ENABLE_JIT) && defined(__x86_64__) && !defined(_WIN32)
+  if (!parser.isJitActive()) {
+    std::cerr << "JIT should be active on this platform" << std::endl;
+    std::exit(1);
+  }
+#endif
+  FlatResult jitted, flat;
+  ParseResult parsed;
+  for (size_t n = 0; n < count; ++n) {
+    const char *frame = frames.data() + n * length;
+    if (interpreted.tryParse(frame, length, parsed) != FrameStatus::Ok) continue;
+    parser.parse(frame, length, jitted);
+    interpreted.parse(frame, length, flat);
+    for (size_t i = 0; i < parsed.size(); ++i) {
+      const ParsedValue expected = parsed[i];
+      const ParsedValue actual = flat[i];
+      const double *a = actual.getIf<double>();
+      const double *e = expected.getIf<double>();
+      bool same = a && e ? std::memcmp(a, e, sizeof(double)) == 0 : actual.getValue() == expected.getValue();
+      if (!same || jitted.data()[i] != flat.data()[i]) {
+        std::cerr << "FlatResult differs at " << parsed.nameAt(i) << ": jit " << jitted[i].toString()
+                  << ", interpreted " << actual.toString() << ", parse() " << expected.toString() << std::endl;
+        std::exit(1);
+      }
+    }
+  }
+}
+
+void test_jit() {
+  std::cout << "Running test_jit..." << std::endl;
+  ByteParser mixed = makeMixedParser();
+  checkFlatDecoding(mixed, makeMixedFrames(2000, kMixedLength, 23), 2000);
+
+  // Wide masks, big-endian floats, signed bit fields and -0.0 scaling
+  ByteParser wide;
+  wide.setTotalLength(24)
+      .addField<float>("f.scaled", 0, 0, 0, true, -0.5, 2.0)
+      .addField<uint32_t>("u32.bits", 4, 1, 31)
+      .addField<int32_t>("i32", 8)
+      .addField<uint8_t>("u8.bits", 12, 5, 3)
+      .addField<int8_t>("i8.bits", 13, 0, 7)
+      .addField<int32_t>("i32.bits", 14, 0, 32, false)
+      .addField<uint16_t>("u16.negated", 18, 0, 0, true, -1.0, 0.0)
+      .addField<bool>("b", 20)
+      .addField<int16_t>("i16", 21);
+  std::vector<char> frames(24 * 2000);
+  std::srand(24);
+  for (auto &b : frames) b = static_cast<char>(std::rand() % 5 == 0 ? 0 : std::rand() & 0xFF);
+  checkFlatDecoding(wide, frames, 2000);
+
+  // Typed handles read slots directly
+  ParseResult parsed;
+  FlatResult flat;
+  wide.parse(frames.data(), 24, parsed);
+  wide.parse(frames.data(), 24, flat);
+  auto i32 = wide.fieldHandle<int64_t>("i32");
+  auto b = wide.fieldHandle<bool>("b");
+  if (flat.get(i32) != parsed.get(i32) || flat.get(b) != parsed.get(b) || flat.nameAt(2) != "i32") {
+    std::cerr << "FlatResult handle access failed" << std::endl;
+    std::exit(1);
+  }
+
+  // Projections keep the JIT setting
+  ByteParser few = wide.select({"i16", "f.scaled"});
+  if (few.isJitActive() != wide.isJitActive()) {
+    std::cerr << "Projection lost the JIT setting" << std::endl;
+    std::exit(1);
+  }
+  std::cout << "test_jit PASSED" << std::endl;
+}
+
+void test_raw_integers() {
+  std::cout << "Running test_raw_integers..." << std::endl;
+  ByteParser scaled = makeMixedParser();
+  ByteParser raw = makeMixedParser();
+  raw.setRawIntegers(true).setJit(true);
+
+  // Classification of the mixed layout: 0.25 / -3 and 0.5 are powers of two, 3 / 1 integral, 0.1 neither
+  if (raw.affine("u8").kind != ScaleKind::Identity || raw.affine("flag").kind != ScaleKind::Identity ||
+      raw.affine("i32.scaled").kind != ScaleKind::PowerOfTwo || raw.affine("i32.scaled").exponent != -2 ||
+      raw.affine("u32.scaled").kind != ScaleKind::PowerOfTwo || raw.affine("i8.scaled").kind != ScaleKind::Integer ||
+      raw.affine("i8.scaled").integerScale != 3 || raw.affine("i8.scaled").integerBias != 1 ||
+      raw.affine("u16.bits.scaled").kind != ScaleKind::Affine) {
+    std::cerr << "Scale classification failed" << std::endl;
+    std::exit(1);
+  }
+  bool thrown = false;
+  try {
+    (void)raw.affine("missing");
+  } catch (const std::runtime_error &) {
+    thrown = true;
+  }
+  if (!thrown) {
+    std::cerr << "affine() accepted an unknown field" << std::endl;
+    std::exit(1);
+  }
+
+  // Integers stay raw in every output, applying the affine reproduces the scaled value bit for bit
+  const size_t count = 500;
+  auto frames = makeMixedFrames(count, kMixedLength, 31);
+  BatchResult rows;
+  ColumnarBatch columns;
+  scaled.parseBatch(frames.data(), count, kMixedLength, rows);
+  raw.parseBatch(frames.data(), count, kMixedLength, columns);
+  ParseResult rawResult;
+  FlatResult flat;
+  for (size_t i = 0; i < count; ++i) {
+    const char *frame = frames.data() + i * kMixedLength;
+    raw.parse(frame, kMixedLength, rawResult);
+    raw.parse(frame, kMixedLength, flat);
+    for (size_t c = 0; c < rawResult.size(); ++c) {
+      const std::string &name = rawResult.nameAt(c);
+      const Affine affine = raw.affine(name);
+      const double expected = rows.value(i, c).get<double>();
+      const bool integer = name != "f";
+      if ((integer && rawResult[c].getIf<double>()) || rawResult[c].toString() != flat[c].toString() ||
+          !sameDouble(affine.apply(rawResult[c].get<double>()), expected) ||
+          !sameDouble(affine.apply(columnValue(columns.column(c), i)), expected)) {
+        std::cerr << "Raw output differs at frame " << i << " field " << name << std::endl;
+        std::exit(1);
+      }
+    }
+  }
+
+  // Filters still compare scaled values
+  ByteParser filtered = makeMixedParser();
+  filtered.setRawIntegers(true).addFilter("u32.scaled", ">=", 1e9);
+  BatchResult kept;
+  filtered.parseBatch(frames.data(), count, kMixedLength, kept);
+  for (size_t i = 0; i < count; ++i) {
+    if ((kept.status(i) == FrameStatus::Ok) != (rows.value(i, 10).get<double>() >= 1e9)) {
+      std::cerr << "Raw output changed filter semantics at frame " << i << std::endl;
+      std::exit(1);
+    }
+  }
+
+  // Q-format: exact for power-of-two and integral transforms, within 1 LSB otherwise
+  for (const char *name : {"i32.scaled", "i8.scaled", "u16.bits.scaled", "u8"}) {
+    const Affine affine = raw.affine(name);
+    const FixedPoint q8 = affine.fixedPoint(8);
+    if (q8.exact != (affine.kind != ScaleKind::Affine)) {
+      std::cerr << "Q-format exactness wrong for " << name << std::endl;
+      std::exit(1);
+    }
+    for (size_t i = 0; i < count; ++i) {
+      const auto value = raw.parse(frames.data() + i * kMixedLength, kMixedLength).at(name).get<int64_t>();
+      const double reference = std::ldexp(affine.apply(static_cast<double>(value)), 8);
+      const int64_t fixed = q8.apply(value);
+      if (q8.exact ? fixed != std::llround(reference) : std::fabs(fixed - reference) > 1.0) {
+        std::cerr << "Q-format conversion of " << name << " failed" << std::endl;
+        std::exit(1);
+      }
+    }
+  }
+  thrown = false;
+  try {
+    (void)raw.affine("u32.scaled").fixedPoint(40);
+  } catch (const std::out_of_range &) {
+    thrown = true;
+  }
+  if (!thrown) {
+    std::cerr << "fixedPoint() accepted an overflowing format" << std::endl;
+    std::exit(1);
+  }
+  std::cout << "test_raw_integers PASSED" << std::endl;
+}
+
+// --- 64-bit and double fields ---
+
+const size_t kWideLength = 48;
+
+static void putBits(std::vector<char> &frame, size_t offset, uint64_t value, bool bigEndian) {
+  for (size_t i = 0; i < 8; ++i) frame[offset + i] = static_cast<char>(value >> (8 * (bigEndian ? 7 - i : i)));
+}
+
+static uint64_t bitsOf(double value) {
+  uint64_t bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+  return bits;
+}
+
+static void sealWideFrame(std::vector<char> &frame) {
+  frame[0] = static_cast<char>(0xA5);
+  frame[1] = static_cast<char>(0x5A);
+  uint16_t crc = calcCRC(frame, kWideLength - 2);
+  frame[kWideLength - 2] = static_cast<char>(crc & 0xFF);
+  frame[kWideLength - 1] = static_cast<char>(crc >> 8);
+}
+
+// Random frames for test_config_wide.ini, with plenty of values >= 2^63 and doubles of any kind
+static std::vector<char> makeWideFrames(size_t count, size_t stride, unsigned seed) {
+  std::vector<char> data(count * stride, 0);
+  std::srand(seed);
+  for (size_t n = 0; n < count; ++n) {
+    std::vector<char> frame(kWideLength);
+    for (auto &b : frame) b = static_cast<char>(std::rand() & 0xFF);
+    sealWideFrame(frame);
+    std::copy(frame.begin(), frame.end(), data.begin() + n * stride);
+  }
+  return data;
+}
+
+// Exact comparison of a column entry with the row decoder
+static bool sameColumnValue(const Column &column, size_t index, const ParsedValue &expected) {
+  return std::visit(
+      [&](const auto &col) {
+        using C = std::decay_t<decltype(col)>;
+        if constexpr (std::is_same_v<C, std::vector<double>>)
+          return std::memcmp(&col[index], expected.getIf<double>(), sizeof(double)) == 0;
+        else if constexpr (std::is_same_v<C, BitColumn>)
+          return col[index] == expected.get<bool>();
+        else
+          return col[index] == expected.get<typename C::value_type>();
+      },
+      column);
+}
+
+static void checkWideColumns(ByteParser &parser, unsigned seed) {
+  for (size_t stride : {parser.getTotalLength(), parser.getTotalLength() + 3}) {
+    for (size_t count : {size_t(1), size_t(7), size_t(203)}) {
+      std::vector<char> data(count * stride);
+      std::srand(seed);
+      for (auto &b : data) b = static_cast<char>(std::rand() & 0xFF);
+      if (parser.getTotalLength() == kWideLength) data = makeWideFrames(count, stride, seed);
+      BatchResult rows;
+      parser.parseBatch(data.data(), count, stride, rows);
+      for (auto level : {simd::Level::Scalar, simd::Level::SSE41, simd::Level::AVX2}) {
+        ColumnarBatch columns;
+        simd::setLevelLimit(level);
+        parser.parseBatch(data.data(), count, stride, columns);
+        for (size_t c = 0; c < columns.columnCount(); ++c) {
+          for (size_t i = 0; i < count; ++i) {
+            if (!sameColumnValue(columns.column(c), i, rows.value(i, c))) {
+              std::cerr << "Wide column " << c << " differs at frame " << i << " (SIMD level "
+                        << static_cast<int>(level) << ", stride " << stride << ")" << std::endl;
+              std::exit(1);
+            }
+          }
+        }
+      }
+    }
+  }
+  simd::setLevelLimit(simd::Level::AVX2);
+}
+
+EBP_FIELD_NAME(WideTimestamp, "wide.timestamp");
+EBP_FIELD_NAME(WideCounter, "wide.counter");
+EBP_FIELD_NAME(WideScaled, "wide.scaled");
+EBP_FIELD_NAME(WideBits, "wide.bits");
+using WideSchema = Schema<Frame<48, 2, 2>, Field<WideTimestamp, uint64_t, 2>, Field<WideCounter, int64_t, 10, LittleEndian>,
+                          Field<WideScaled, double, 26, LittleEndian, NoBits, std::ratio<1, 2>, std::ratio<-1>>,
+                          Field<WideBits, uint64_t, 34, BigEndian, Bits<4, 60>>>;
+static_assert(std::is_same_v<decltype(WideSchema::decodeField<WideCounter>(nullptr)), int64_t>);
+
+void test_wide_types() {
+  std::cout << "Running test_wide_types..." << std::endl;
+  ByteParser parser;
+  parser.loadConfig("test_config_wide.ini");
+
+  // Known values in both byte orders
+  std::vector<char> frame(kWideLength, 0);
+  const uint64_t timestamp = 0x0123456789ABCDEFull;
+  const int64_t counter = -1234567890123ll;
+  const uint64_t bits = 0xFEDCBA9876543210ull;
+  putBits(frame, 2, timestamp, true);
+  putBits(frame, 10, static_cast<uint64_t>(counter), false);
+  putBits(frame, 18, bitsOf(-2.75), true);
+  putBits(frame, 26, bitsOf(1e10), false);
+  putBits(frame, 34, bits, true);
+  frame[42] = static_cast<char>(0xEF);
+  frame[43] = static_cast<char>(0xBE);
+  frame[44] = static_cast<char>(0xAD);
+  frame[45] = static_cast<char>(0xDE);
+  sealWideFrame(frame);
+
+  ParseResult result;
+  parser.parse(frame.data(), kWideLength, result);
+  const uint64_t *ts = result.at("wide.timestamp").getIf<uint64_t>();
+  const int64_t *cnt = result.at("wide.counter").getIf<int64_t>();
+  const double *value = result.at("wide.value").getIf<double>();
+  const double *scaled = result.at("wide.scaled").getIf<double>();
+  const uint64_t *wideBits = result.at("wide.bits").getIf<uint64_t>();
+  if (!ts || *ts != timestamp || !cnt || *cnt != counter || !value || *value != -2.75 || !scaled ||
+      *scaled != 1e10 * 0.5 - 1.0 || !wideBits || *wideBits != bits >> 4 || result.at("wide.u32").get<uint64_t>() != 0xDEADBEEF) {
+    std::cerr << "64-bit field values are wrong" << std::endl;
+    std::exit(1);
+  }
+  auto counterHandle = parser.fieldHandle<int64_t>("wide.counter");
+  ColumnarBatch single;
+  parser.parseBatch(frame.data(), 1, kWideLength, single);
+  if (result.get(counterHandle) != counter || single.column<int64_t>(1)[0] != counter ||
+      single.column<uint64_t>(4)[0] != bits >> 4) {
+    std::cerr << "64-bit field handle or column access failed" << std::endl;
+    std::exit(1);
+  }
+
+  // Width checks use 8 bytes
+  bool thrown = false;
+  try {
+    ByteParser tooLong;
+    tooLong.setTotalLength(12).addField<double>("d", 5);
+    tooLong.compile();
+  } catch (const std::runtime_error &) {
+    thrown = true;
+  }
+  if (!thrown) {
+    std::cerr << "8-byte field past TotalLength accepted" << std::endl;
+    std::exit(1);
+  }
+
+  // Every decode path agrees with parse(): JIT and interpreted slots, SIMD columns, filters
+  const size_t count = 500;
+  auto frames = makeWideFrames(count, kWideLength, 25);
+  checkFlatDecoding(parser, frames, count);
+  checkWideColumns(parser, 25);
+
+  ByteParser filtered = parser;
+  filtered.addFilter("wide.timestamp", ">=", 9223372036854775808.0);
+  BatchResult rows, kept;
+  parser.parseBatch(frames.data(), count, kWideLength, rows);
+  filtered.parseBatch(frames.data(), count, kWideLength, kept);
+  for (size_t i = 0; i < count; ++i) {
+    const bool high = rows.value(i, 0).get<uint64_t>() >> 63;
+    if ((kept.status(i) == FrameStatus::Ok) != high) {
+      std::cerr << "Filter on a uint64 field failed at frame " << i << std::endl;
+      std::exit(1);
+    }
+  }
+
+  // Scaled 64-bit integers and full-width bit fields, including unsigned values >= 2^63
+  ByteParser converted;
+  converted.setTotalLength(32)
+      .addField<uint64_t>("u64.scaled", 0, 0, 0, true, 0.001, 5.0)
+      .addField<int64_t>("i64.scaled", 8, 0, 0, false, -0.25, 0.0)
+      .addField<int64_t>("i64.all_bits", 16, 0, 64, true, 2.0, 0.0)
+      .addField<uint64_t>("u64.high_bits", 24, 33, 31, false);
+  std::vector<char> random(32 * count);
+  std::srand(26);
+  for (auto &b : random) b = static_cast<char>(std::rand() & 0xFF);
+  checkFlatDecoding(converted, random, count);
+  checkWideColumns(converted, 26);
+
+  // Integer and power-of-two transforms of 64-bit raws could overflow int64_t arithmetic
+  bool rejected = false;
+  try {
+    (void)converted.affine("i64.all_bits").fixedPoint(0);
+  } catch (const std::out_of_range &) {
+    rejected = true;
+  }
+  if (converted.affine("i64.all_bits").kind != ScaleKind::Affine || converted.affine("i64.scaled").kind != ScaleKind::Affine ||
+      converted.affine("u64.high_bits").rawBits != 31 || !rejected) {
+    std::cerr << "64-bit raws must not be classified for integer arithmetic" << std::endl;
+    std::exit(1);
+  }
+  for (size_t n = 0; n < count; ++n) {
+    const char *f = random.data() + n * 32;
+    uint64_t raw = 0;
+    for (size_t i = 0; i < 8; ++i) raw = raw << 8 | static_cast<uint8_t>(f[i]);
+    if (converted.parse(f, 32).at("u64.scaled").get<double>() != static_cast<double>(raw) * 0.001 + 5.0) {
+      std::cerr << "Unsigned 64-bit conversion failed at frame " << n << std::endl;
+      std::exit(1);
+    }
+  }
+
+  // Compile-time schema and generated decoder
+  for (size_t n = 0; n < count; ++n) {
+    const char *f = frames.data() + n * kWideLength;
+    parser.parse(f, kWideLength, result);
+    const WideSchema::Values values = WideSchema::decode(f);
+    if (values.get<WideTimestamp>() != result[0].get<uint64_t>() ||
+        values.get<WideCounter>() != result[1].get<int64_t>() ||
+        !sameDouble(values.get<WideScaled>(), result[3].get<double>()) ||
+        values.get<WideBits>() != result[4].get<uint64_t>()) {
+      std::cerr << "Wide schema differs from parse() at frame " << n << std::endl;
+      std::exit(1);
+    }
+#ifdef EBP_TEST_CODEGEN
+    generated::TestConfigWide decoded;
+    generated::decode(f, decoded);
+    if (decoded.wide_timestamp != result[0].get<uint64_t>() || decoded.wide_counter != result[1].get<int64_t>() ||
+        std::memcmp(&decoded.wide_value, result[2].getIf<double>(), sizeof(double)) != 0 ||
+        !sameDouble(decoded.wide_scaled, result[3].get<double>()) || decoded.wide_bits != result[4].get<uint64_t>()) {
+      std::cerr << "Generated wide decoder differs from parse() at frame " << n << std::endl;
+      std::exit(1);
+    }
+#endif
+  }
+  std::cout << "test_wide_types PASSED" << std::endl;
+}
+
 int main() {
   test_parsing();
   test_threads();
@@ -755,5 +2634,31 @@ int main() {
   test_programmatic_api();
   test_programmatic_comprehensive();
   test_programmatic_ini_equivalents();
+  test_compiled_layout();
+  test_config_revalidation();
+  test_parse_result();
+  test_field_handles();
+  test_parse_batch();
+  test_columnar_batch();
+  test_simd_columns();
+  test_crc16_implementations();
+  test_crc_engine();
+  test_checksum_registry();
+  test_stream_framer();
+  test_start_code_scan();
+  test_ring_buffer();
+  test_parse_file();
+  test_parallel_batch();
+  test_pipeline();
+  test_projection();
+  test_filters();
+  test_frame_view();
+  test_schema();
+#ifdef EBP_TEST_CODEGEN
+  test_codegen();
+#endif
+  test_jit();
+  test_raw_integers();
+  test_wide_types();
   return 0;
 }
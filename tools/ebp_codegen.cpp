@@ -0,0 +1,301 @@
+// ebp_codegen: generate a specialized decoder header from an INI configuration.
+//
+// Usage: ebp_codegen <config.ini> <output.hpp> [--name StructName] [--namespace ns]
+//
+// The configuration is loaded and validated by ByteParser::loadConfig(), so an invalid layout fails
+// the build. The header holds one POD struct with a member per field and an inline, branch-free
+// decode(const char*, Struct&) with all offsets, byte orders, shifts and scales as constants.
+// Values follow the runtime parser: bools stay bool, floats and scaled fields are double,
+// bit fields use the unsigned wire type and other integers keep their wire type.
+// Like Schema::decode(), decode() does not check the frame; use ByteParser::check() for that.
+
+#include <cctype>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+#include "EasyByteParserCpp/ByteParser.hpp"
+
+using namespace easy_byte_parser;
+
+namespace {
+
+struct Options {
+  std::string config;
+  std::string output;
+  std::string name;
+  std::string nameSpace;
+};
+
+struct WireType {
+  const char* name;  // C++ type
+  size_t size;
+};
+
+WireType wireTypeOf(const std::string& type) {
+  if (type == "uint8") return {"uint8_t", 1};
+  if (type == "int8") return {"int8_t", 1};
+  if (type == "uint16") return {"uint16_t", 2};
+  if (type == "int16") return {"int16_t", 2};
+  if (type == "uint32") return {"uint32_t", 4};
+  if (type == "int32") return {"int32_t", 4};
+  if (type == "uint64") return {"uint64_t", 8};
+  if (type == "int64") return {"int64_t", 8};
+  if (type == "float") return {"float", 4};
+  if (type == "double") return {"double", 8};
+  if (type == "bool") return {"bool", 1};
+  throw std::runtime_error("[EasyByteParserCpp]: Invalid Type: " + type);
+}
+
+const char* unsignedOfSize(size_t size) {
+  switch (size) {
+    case 1:
+      return "uint8_t";
+    case 2:
+      return "uint16_t";
+    case 4:
+      return "uint32_t";
+    default:
+      return "uint64_t";
+  }
+}
+
+/// C++ keywords and alternative tokens (up to C++20), which cannot be used as names, plus the constants and
+/// types of the generated struct, which members would clash with.
+bool isReserved(const std::string& id) {
+  static const std::set<std::string> reserved = {
+      "totalLength", "startCodeLength", "startCode", "crcAlgo", "crcLength", "fieldCount", "size_t", "uint8_t",
+      "int8_t", "uint16_t", "int16_t", "uint32_t", "int32_t", "uint64_t", "int64_t",
+      "alignas", "alignof", "and", "and_eq", "asm", "auto", "bitand", "bitor", "bool", "break", "case", "catch",
+      "char", "char8_t", "char16_t", "char32_t", "class", "co_await", "co_return", "co_yield", "compl", "concept",
+      "const", "consteval", "constexpr", "constinit", "const_cast", "continue", "decltype", "default", "delete", "do",
+      "double", "dynamic_cast", "else", "enum", "explicit", "export", "extern", "false", "float", "for", "friend",
+      "goto", "if", "inline", "int", "long", "mutable", "namespace", "new", "noexcept", "not", "not_eq", "nullptr",
+      "operator", "or", "or_eq", "private", "protected", "public", "register", "reinterpret_cast", "requires",
+      "return", "short", "signed", "sizeof", "static", "static_assert", "static_cast", "struct", "switch", "template",
+      "this", "thread_local", "throw", "true", "try", "typedef", "typeid", "typename", "union", "unsigned", "using",
+      "virtual", "void", "volatile", "wchar_t", "while", "xor", "xor_eq"};
+  return reserved.count(id) != 0;
+}
+
+/// C++ identifier from a field or file name: other characters become '_', reserved names get a trailing '_'.
+std::string identifier(const std::string& text) {
+  std::string id;
+  for (char c : text) id += std::isalnum(static_cast<unsigned char>(c)) ? c : '_';
+  if (id.empty() || std::isdigit(static_cast<unsigned char>(id[0]))) id = "_" + id;
+  if (isReserved(id)) id += '_';
+  return id;
+}
+
+/// C++ string literal with quotes, backslashes and non-printable characters escaped.
+std::string stringLiteral(const std::string& text) {
+  std::string out = "\"";
+  for (char c : text) {
+    const auto byte = static_cast<unsigned char>(c);
+    if (c == '"' || c == '\\') {
+      out += '\\';
+      out += c;
+    } else if (std::isprint(byte)) {
+      out += c;
+    } else {
+      // Octal escapes end after three digits, unlike \x which would absorb following hex characters
+      char buffer[8];
+      std::snprintf(buffer, sizeof(buffer), "\\%03o", byte);
+      out += buffer;
+    }
+  }
+  return out + "\"";
+}
+
+/// CamelCase struct name from the configuration file name, e.g. engine_status.ini -> EngineStatus.
+std::string structNameOf(const std::string& path) {
+  std::string stem = path.substr(path.find_last_of("/\\") + 1);
+  stem = stem.substr(0, stem.find('.'));
+  std::string name;
+  bool upper = true;
+  for (char c : stem) {
+    if (!std::isalnum(static_cast<unsigned char>(c))) {
+      upper = true;
+      continue;
+    }
+    name += upper ? static_cast<char>(std::toupper(static_cast<unsigned char>(c))) : c;
+    upper = false;
+  }
+  return identifier(name);
+}
+
+/// Double literal that reads back to exactly \p value.
+std::string literal(double value) {
+  char buffer[32];
+  std::snprintf(buffer, sizeof(buffer), "%.17g", value);
+  std::string text = buffer;
+  if (text.find_first_of(".en") == std::string::npos) text += ".0";
+  return text;
+}
+
+std::string hexByte(uint8_t value) {
+  char buffer[8];
+  std::snprintf(buffer, sizeof(buffer), "0x%02X", value);
+  return buffer;
+}
+
+/// Value type of a field in the generated struct.
+std::string valueTypeOf(const FieldDefinition& f) {
+  WireType wire = wireTypeOf(f.type);
+  bool scaled = f.type != "bool" && (f.scale != 1.0 || f.bias != 0.0);
+  if (f.type == "bool") return "bool";
+  if (f.type == "float" || f.type == "double" || scaled) return "double";
+  if (f.bitCount > 0) return unsignedOfSize(wire.size);
+  return wire.name;
+}
+
+/// Expression decoding a field from `data`.
+std::string decodeExpression(const FieldDefinition& f) {
+  WireType wire = wireTypeOf(f.type);
+  const std::string raw = std::string("ebp_generated::load<") + unsignedOfSize(wire.size) + ", " +
+                          (f.isBigEndian ? "true" : "false") + ">(data + " + std::to_string(f.byteOffset) + ")";
+  const bool scaled = f.type != "bool" && (f.scale != 1.0 || f.bias != 0.0);
+  auto scale = [&](const std::string& value) {
+    return "static_cast<double>(" + value + ") * " + literal(f.scale) + " + " + literal(f.bias);
+  };
+
+  if (f.type == "bool") {
+    if (f.bitCount > 0) return "((" + raw + " >> " + std::to_string(f.bitOffset) + ") & 1u) != 0";
+    return raw + " != 0";
+  }
+  if (f.type == "float") {
+    std::string value = "ebp_generated::toFloat(" + raw + ")";
+    return scaled ? scale(value) : "static_cast<double>(" + value + ")";
+  }
+  if (f.type == "double") {
+    std::string value = "ebp_generated::toDouble(" + raw + ")";
+    return scaled ? scale(value) : value;
+  }
+  std::string value;
+  if (f.bitCount > 0) {
+    uint64_t mask = f.bitCount >= 64 ? ~uint64_t{0} : (uint64_t{1} << f.bitCount) - 1;
+    value = std::string("static_cast<") + unsignedOfSize(wire.size) + ">((" + raw + " >> " +
+            std::to_string(f.bitOffset) + ") & " + std::to_string(mask) + "u)";
+  } else {
+    value = std::string("static_cast<") + wire.name + ">(" + raw + ")";
+  }
+  return scaled ? scale(value) : value;
+}
+
+std::string generate(const ByteParser& parser, const Options& options) {
+  const std::string name = options.name.empty() ? structNameOf(options.config) : options.name;
+  std::ostringstream out;
+  std::string configName = options.config.substr(options.config.find_last_of("/\\") + 1);
+  out << "// Generated by ebp_codegen from " << configName << ". Do not edit.\n"
+      << "#pragma once\n\n"
+      << "#include <cstddef>\n"
+      << "#include <cstdint>\n"
+      << "#include <cstring>\n\n"
+      << "#ifndef EBP_GENERATED_HELPERS\n"
+      << "#define EBP_GENERATED_HELPERS\n"
+      << "namespace ebp_generated {\n\n"
+      << "// Assembled byte by byte; compilers fold this into one load plus a byte swap if needed.\n"
+      << "template <typename U, bool IsBigEndian>\n"
+      << "inline U load(const char* data) noexcept {\n"
+      << "  const auto* bytes = reinterpret_cast<const unsigned char*>(data);\n"
+      << "  U value = 0;\n"
+      << "  for (size_t i = 0; i < sizeof(U); ++i)\n"
+      << "    value |= static_cast<U>(static_cast<U>(bytes[i]) << (8 * (IsBigEndian ? sizeof(U) - 1 - i : i)));\n"
+      << "  return value;\n"
+      << "}\n\n"
+      << "inline float toFloat(uint32_t bits) noexcept {\n"
+      << "  float value;\n"
+      << "  std::memcpy(&value, &bits, sizeof(value));\n"
+      << "  return value;\n"
+      << "}\n\n"
+      << "inline double toDouble(uint64_t bits) noexcept {\n"
+      << "  double value;\n"
+      << "  std::memcpy(&value, &bits, sizeof(value));\n"
+      << "  return value;\n"
+      << "}\n\n"
+      << "}  // namespace ebp_generated\n"
+      << "#endif  // EBP_GENERATED_HELPERS\n\n";
+
+  if (!options.nameSpace.empty()) out << "namespace " << options.nameSpace << " {\n\n";
+
+  out << "struct " << name << " {\n"
+      << "  static constexpr size_t totalLength = " << parser.getTotalLength() << ";\n"
+      << "  static constexpr size_t startCodeLength = " << parser.getStartCodeLength() << ";\n";
+  if (!parser.getStartCode().empty()) {
+    out << "  static constexpr uint8_t startCode[] = {";
+    for (size_t i = 0; i < parser.getStartCode().size(); ++i) {
+      out << (i ? ", " : "") << hexByte(parser.getStartCode()[i]);
+    }
+    out << "};\n";
+  }
+  out << "  static constexpr const char* crcAlgo = " << stringLiteral(parser.getCRCAlgo()) << ";\n"
+      << "  static constexpr size_t crcLength = " << parser.getCRCLength() << ";\n"
+      << "  static constexpr size_t fieldCount = " << parser.getFields().size() << ";\n\n";
+
+  // Member name -> name of the field it was generated from
+  std::map<std::string, std::string> members;
+  for (const auto& f : parser.getFields()) {
+    std::string member = identifier(f.name);
+    auto [it, inserted] = members.emplace(member, f.name);
+    if (!inserted) {
+      throw std::runtime_error("Fields " + it->second + " and " + f.name + " both map to the member name " + member +
+                               ", rename one of them");
+    }
+    out << "  " << valueTypeOf(f) << " " << member << ";  // " << f.name << "\n";
+  }
+  out << "};\n\n";
+
+  out << "/// Decode a frame of at least " << name << "::totalLength bytes. Does not check StartCode or CRC.\n"
+      << "inline void decode(const char* data, " << name << "& out) noexcept {\n";
+  for (const auto& f : parser.getFields()) {
+    out << "  out." << identifier(f.name) << " = " << decodeExpression(f) << ";\n";
+  }
+  out << "}\n";
+
+  if (!options.nameSpace.empty()) out << "\n}  // namespace " << options.nameSpace << "\n";
+  return out.str();
+}
+
+Options parseArguments(int argc, char** argv) {
+  Options options;
+  for (int i = 1; i < argc; ++i) {
+    std::string arg = argv[i];
+    if ((arg == "--name" || arg == "--namespace") && i + 1 < argc) {
+      (arg == "--name" ? options.name : options.nameSpace) = argv[++i];
+    } else if (options.config.empty()) {
+      options.config = arg;
+    } else if (options.output.empty()) {
+      options.output = arg;
+    } else {
+      throw std::runtime_error("Unexpected argument: " + arg);
+    }
+  }
+  if (options.output.empty()) {
+    throw std::runtime_error("Usage: ebp_codegen <config.ini> <output.hpp> [--name StructName] [--namespace ns]");
+  }
+  return options;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  try {
+    Options options = parseArguments(argc, argv);
+    ByteParser parser;
+    parser.loadConfig(options.config);
+    std::string header = generate(parser, options);
+
+    std::ofstream file(options.output, std::ios::binary | std::ios::trunc);
+    file << header;
+    if (!file) throw std::runtime_error("Cannot write " + options.output);
+    return 0;
+  } catch (const std::exception& e) {
+    std::cerr << "ebp_codegen: " << e.what() << std::endl;
+    return 1;
+  }
+}